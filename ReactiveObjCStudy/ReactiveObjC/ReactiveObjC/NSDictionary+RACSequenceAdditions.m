@@ -8,6 +8,7 @@
 
 #import "NSDictionary+RACSequenceAdditions.h"
 #import "NSArray+RACSequenceAdditions.h"
+#import "NSIndexSet+RACSequenceAdditions.h"
 #import "RACSequence.h"
 #import "RACTuple.h"
 
@@ -16,10 +17,16 @@
 - (RACSequence *)rac_sequence {
 	NSDictionary *immutableDict = [self copy];
 
-	// TODO: First class support for dictionary sequences.
-	return [immutableDict.allKeys.rac_sequence map:^(id key) {
-		id value = immutableDict[key];
-		return RACTuplePack(key, value);
+	// Fetch every value up front, in the same order as the keys, so that
+	// building each tuple doesn't need a lookup.
+	NSArray *keys = immutableDict.allKeys;
+	NSArray *values = [immutableDict objectsForKeys:keys notFoundMarker:NSNull.null];
+
+	NSIndexSet *indexes = [NSIndexSet indexSetWithIndexesInRange:NSMakeRange(0, keys.count)];
+
+	return [indexes.rac_sequence map:^(NSNumber *index) {
+		NSUInteger i = index.unsignedIntegerValue;
+		return RACTuplePack(keys[i], values[i]);
 	}];
 }
 
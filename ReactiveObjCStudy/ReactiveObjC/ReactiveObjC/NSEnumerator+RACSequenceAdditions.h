@@ -19,6 +19,13 @@ NS_ASSUME_NONNULL_BEGIN
 // The receiver is exhausted lazily as the sequence is enumerated.
 @property (nonatomic, copy, readonly) RACSequence<ObjectType> *rac_sequence;
 
+// Creates and returns a streaming sequence corresponding to the receiver.
+//
+// Unlike -rac_sequence, the values of the receiver aren't memoized, so they can
+// be enumerated only once, but holding onto the sequence doesn't retain every
+// value ever enumerated. See -[RACSequence streamingSequence].
+@property (nonatomic, copy, readonly) RACSequence<ObjectType> *rac_streamingSequence;
+
 @end
 
 NS_ASSUME_NONNULL_END
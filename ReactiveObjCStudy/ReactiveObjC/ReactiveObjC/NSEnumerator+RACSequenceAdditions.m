@@ -8,6 +8,7 @@
 
 #import "NSEnumerator+RACSequenceAdditions.h"
 #import "RACSequence.h"
+#import "RACStreamingSequence.h"
 
 @implementation NSEnumerator (RACSequenceAdditions)
 
@@ -19,4 +20,10 @@
 	}];
 }
 
+- (RACSequence *)rac_streamingSequence {
+	return [RACStreamingSequence sequenceWithGenerator:^{
+		return [self nextObject];
+	}];
+}
+
 @end
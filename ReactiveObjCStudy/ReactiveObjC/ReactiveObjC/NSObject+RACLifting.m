@@ -13,6 +13,178 @@
 #import "NSObject+RACDescription.h"
 #import "RACSignal+Operations.h"
 #import "RACTuple.h"
+#import "RACUnit.h"
+#import <objc/message.h>
+#import <objc/runtime.h>
+
+// The maximum number of arguments for which a lifted method can be called
+// directly through its IMP.
+static const NSUInteger RACLiftedMethodMaximumArgumentCount = 4;
+
+// How an argument is converted before being passed directly to an IMP.
+//
+// Apart from objects, which are passed as is, each kind is unboxed with the
+// same accessor that -rac_setArgument:atIndex: uses for that type, so that the
+// value is truncated and then sign or zero extended exactly as the parameter
+// type requires.
+typedef NS_ENUM(NSUInteger, RACLiftedArgumentKind) {
+	RACLiftedArgumentKindObject,
+	RACLiftedArgumentKindChar,
+	RACLiftedArgumentKindInt,
+	RACLiftedArgumentKindShort,
+	RACLiftedArgumentKindLong,
+	RACLiftedArgumentKindLongLong,
+	RACLiftedArgumentKindUnsignedChar,
+	RACLiftedArgumentKindUnsignedInt,
+	RACLiftedArgumentKindUnsignedShort,
+	RACLiftedArgumentKindUnsignedLong,
+	RACLiftedArgumentKindUnsignedLongLong,
+	RACLiftedArgumentKindBool,
+};
+
+// Describes how to call a lifted method directly through its IMP.
+typedef struct {
+	NSUInteger argumentCount;
+	RACLiftedArgumentKind argumentKinds[RACLiftedMethodMaximumArgumentCount];
+
+	// Whether the method returns an object, rather than void.
+	BOOL returnsObject;
+} RACLiftedMethod;
+
+// Returns a type encoding without its const qualifier.
+static const char *RACLiftedUnqualifiedType(const char *type) {
+	return (type[0] == 'r' ? type + 1 : type);
+}
+
+// Determines how an argument of the given type can be passed directly to an
+// IMP.
+//
+// Objects and integers no wider than a pointer are passed as a pointer-sized
+// integer, since every Apple ABI passes those in general-purpose registers in
+// the same way. Anything else (floating-point values, structs, C strings)
+// requires NSInvocation.
+//
+// Returns whether the type is supported, setting `kind` if so.
+static BOOL RACLiftedArgumentKindForType(const char *type, RACLiftedArgumentKind *kind) {
+	type = RACLiftedUnqualifiedType(type);
+
+	if (strcmp(type, @encode(id)) == 0 || strcmp(type, @encode(Class)) == 0 || strcmp(type, @encode(void (^)(void))) == 0) {
+		*kind = RACLiftedArgumentKindObject;
+		return YES;
+	}
+
+	NSUInteger size = 0;
+	NSGetSizeAndAlignment(type, &size, NULL);
+	if (size > sizeof(intptr_t)) return NO;
+
+	// Checked in the same order as -rac_setArgument:atIndex:, since BOOL and
+	// char share an encoding on some platforms.
+	if (strcmp(type, @encode(char)) == 0) {
+		*kind = RACLiftedArgumentKindChar;
+	} else if (strcmp(type, @encode(int)) == 0) {
+		*kind = RACLiftedArgumentKindInt;
+	} else if (strcmp(type, @encode(short)) == 0) {
+		*kind = RACLiftedArgumentKindShort;
+	} else if (strcmp(type, @encode(long)) == 0) {
+		*kind = RACLiftedArgumentKindLong;
+	} else if (strcmp(type, @encode(long long)) == 0) {
+		*kind = RACLiftedArgumentKindLongLong;
+	} else if (strcmp(type, @encode(unsigned char)) == 0) {
+		*kind = RACLiftedArgumentKindUnsignedChar;
+	} else if (strcmp(type, @encode(unsigned int)) == 0) {
+		*kind = RACLiftedArgumentKindUnsignedInt;
+	} else if (strcmp(type, @encode(unsigned short)) == 0) {
+		*kind = RACLiftedArgumentKindUnsignedShort;
+	} else if (strcmp(type, @encode(unsigned long)) == 0) {
+		*kind = RACLiftedArgumentKindUnsignedLong;
+	} else if (strcmp(type, @encode(unsigned long long)) == 0) {
+		*kind = RACLiftedArgumentKindUnsignedLongLong;
+	} else if (strcmp(type, @encode(BOOL)) == 0) {
+		*kind = RACLiftedArgumentKindBool;
+	} else {
+		return NO;
+	}
+
+	return YES;
+}
+
+// Determines whether a method with the given signature can be called directly
+// through its IMP.
+//
+// Returns whether it can, filling in `method` if so.
+static BOOL RACLiftedMethodForSignature(NSMethodSignature *signature, RACLiftedMethod *method) {
+	const char *returnType = RACLiftedUnqualifiedType(signature.methodReturnType);
+
+	if (strcmp(returnType, @encode(void)) == 0) {
+		method->returnsObject = NO;
+	} else if (strcmp(returnType, @encode(id)) == 0 || strcmp(returnType, @encode(Class)) == 0) {
+		method->returnsObject = YES;
+	} else {
+		return NO;
+	}
+
+	method->argumentCount = signature.numberOfArguments - 2;
+	if (method->argumentCount > RACLiftedMethodMaximumArgumentCount) return NO;
+
+	for (NSUInteger i = 0; i < method->argumentCount; i++) {
+		if (!RACLiftedArgumentKindForType([signature getArgumentTypeAtIndex:i + 2], &method->argumentKinds[i])) return NO;
+	}
+
+	return YES;
+}
+
+// Calls `imp` with the given arguments, converted as described by `method`.
+//
+// Returns the return value of the method, or RACUnit if it returns void.
+static id RACInvokeLiftedMethod(id target, SEL selector, IMP imp, RACLiftedMethod method, RACTuple *arguments) {
+	// The tuple keeps any objects alive for the duration of the call.
+	intptr_t words[RACLiftedMethodMaximumArgumentCount] = { 0 };
+
+	for (NSUInteger i = 0; i < method.argumentCount; i++) {
+		id argument = arguments[i];
+
+		switch (method.argumentKinds[i]) {
+			case RACLiftedArgumentKindObject:
+				words[i] = (intptr_t)(__bridge void *)argument;
+				break;
+
+			case RACLiftedArgumentKindChar: words[i] = (intptr_t)[argument charValue]; break;
+			case RACLiftedArgumentKindInt: words[i] = (intptr_t)[argument intValue]; break;
+			case RACLiftedArgumentKindShort: words[i] = (intptr_t)[argument shortValue]; break;
+			case RACLiftedArgumentKindLong: words[i] = (intptr_t)[argument longValue]; break;
+			case RACLiftedArgumentKindLongLong: words[i] = (intptr_t)[argument longLongValue]; break;
+			case RACLiftedArgumentKindUnsignedChar: words[i] = (intptr_t)[argument unsignedCharValue]; break;
+			case RACLiftedArgumentKindUnsignedInt: words[i] = (intptr_t)[argument unsignedIntValue]; break;
+			case RACLiftedArgumentKindUnsignedShort: words[i] = (intptr_t)[argument unsignedShortValue]; break;
+			case RACLiftedArgumentKindUnsignedLong: words[i] = (intptr_t)[argument unsignedLongValue]; break;
+			case RACLiftedArgumentKindUnsignedLongLong: words[i] = (intptr_t)[argument unsignedLongLongValue]; break;
+			case RACLiftedArgumentKindBool: words[i] = (intptr_t)[argument boolValue]; break;
+		}
+	}
+
+	if (method.returnsObject) {
+		switch (method.argumentCount) {
+			case 0: return ((id (*)(id, SEL))imp)(target, selector);
+			case 1: return ((id (*)(id, SEL, intptr_t))imp)(target, selector, words[0]);
+			case 2: return ((id (*)(id, SEL, intptr_t, intptr_t))imp)(target, selector, words[0], words[1]);
+			case 3: return ((id (*)(id, SEL, intptr_t, intptr_t, intptr_t))imp)(target, selector, words[0], words[1], words[2]);
+			case 4: return ((id (*)(id, SEL, intptr_t, intptr_t, intptr_t, intptr_t))imp)(target, selector, words[0], words[1], words[2], words[3]);
+		}
+	} else {
+		switch (method.argumentCount) {
+			case 0: ((void (*)(id, SEL))imp)(target, selector); break;
+			case 1: ((void (*)(id, SEL, intptr_t))imp)(target, selector, words[0]); break;
+			case 2: ((void (*)(id, SEL, intptr_t, intptr_t))imp)(target, selector, words[0], words[1]); break;
+			case 3: ((void (*)(id, SEL, intptr_t, intptr_t, intptr_t))imp)(target, selector, words[0], words[1], words[2]); break;
+			case 4: ((void (*)(id, SEL, intptr_t, intptr_t, intptr_t, intptr_t))imp)(target, selector, words[0], words[1], words[2], words[3]); break;
+		}
+
+		return RACUnit.defaultUnit;
+	}
+
+	NSCAssert(NO, @"Unexpected argument count %lu for a lifted method", (unsigned long)method.argumentCount);
+	return nil;
+}
 
 @implementation NSObject (RACLifting)
 
@@ -24,11 +196,24 @@
 	
 	NSMethodSignature *methodSignature = [self methodSignatureForSelector:selector];
 	NSCAssert(methodSignature != nil, @"%@ does not respond to %@", self, NSStringFromSelector(selector));
+
+	// Work out how to call the method once, rather than parsing its type
+	// encoding every time the arguments change.
+	RACLiftedMethod method = { 0 };
+	BOOL canInvokeDirectly = RACLiftedMethodForSignature(methodSignature, &method);
 	
 	return [[[[arguments
 		takeUntil:self.rac_willDeallocSignal]
 		map:^(RACTuple *arguments) {
 			@strongify(self);
+
+			if (canInvokeDirectly && self != nil) {
+				// Look up the IMP on each call, so that swizzling after lifting
+				// (e.g., by KVO) is still respected. Forwarded methods need a
+				// real message send, so they go through NSInvocation instead.
+				IMP imp = class_getMethodImplementation(object_getClass(self), selector);
+				if (imp != _objc_msgForward) return RACInvokeLiftedMethod(self, selector, imp, method, arguments);
+			}
 			
 			NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:methodSignature];
 			invocation.selector = selector;
@@ -20,6 +20,21 @@ NS_ASSUME_NONNULL_BEGIN
 // Mutating the receiver will not affect the sequence after it's been created.
 @property (nonatomic, copy, readonly) RACSequence<NSString *> *rac_sequence;
 
+// Creates and returns a sequence containing each line in the receiver, without
+// its line terminator.
+//
+// Lines are found lazily, as the sequence is evaluated. A line terminator at
+// the end of the receiver doesn't produce an empty last line.
+// Mutating the receiver will not affect the sequence after it's been created.
+@property (nonatomic, copy, readonly) RACSequence<NSString *> *rac_lineSequence;
+
+// Creates and returns a sequence containing each run of characters in the
+// receiver which aren't in `separators`, skipping empty runs.
+//
+// Tokens are found lazily, as the sequence is evaluated.
+// Mutating the receiver will not affect the sequence after it's been created.
+- (RACSequence<NSString *> *)rac_tokenSequenceWithSeparators:(NSCharacterSet *)separators;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,6 +7,7 @@
 //
 
 #import "NSString+RACSequenceAdditions.h"
+#import "RACStringComponentSequence.h"
 #import "RACStringSequence.h"
 
 @implementation NSString (RACSequenceAdditions)
@@ -15,4 +16,12 @@
 	return [RACStringSequence sequenceWithString:self offset:0];
 }
 
+- (RACSequence *)rac_lineSequence {
+	return [RACStringComponentSequence lineSequenceWithString:self];
+}
+
+- (RACSequence *)rac_tokenSequenceWithSeparators:(NSCharacterSet *)separators {
+	return [RACStringComponentSequence tokenSequenceWithString:self separators:separators];
+}
+
 @end
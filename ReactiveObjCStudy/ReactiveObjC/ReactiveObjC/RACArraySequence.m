@@ -49,47 +49,65 @@
 	return sequence;
 }
 
+- (NSEnumerator *)objectEnumerator {
+	// Enumerate the backing storage directly, rather than allocating a tail
+	// sequence for each value.
+	NSArray *array = self.backingArray;
+	if (self.offset > 0) array = [array subarrayWithRange:NSMakeRange(self.offset, array.count - self.offset)];
+
+	return array.objectEnumerator;
+}
+
+- (RACSequence *)chunksOfSize:(NSUInteger)size {
+	NSCParameterAssert(size > 0);
+
+	NSArray *backingArray = self.backingArray;
+	NSUInteger offset = self.offset;
+	NSUInteger length = MIN(size, backingArray.count - offset);
+
+	return [[RACSequence sequenceWithHeadBlock:^{
+		return [backingArray subarrayWithRange:NSMakeRange(offset, length)];
+	} tailBlock:^ RACSequence * {
+		if (offset + length == backingArray.count) return nil;
+
+		return [[self.class sequenceWithArray:backingArray offset:offset + length] chunksOfSize:size];
+	}] setNameWithFormat:@"[%@] -chunksOfSize: %lu", self.name, (unsigned long)size];
+}
+
 #pragma mark NSFastEnumeration
 
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id[])stackbuf count:(NSUInteger)len {
 	NSCParameterAssert(len > 0);
 
-	if (state->state >= self.backingArray.count) {
-		// Enumeration has completed.
-		return 0;
-	}
+	// When the whole array is being sequenced, let it enumerate itself, which
+	// usually hands out its internal storage directly.
+	if (self.offset == 0) return [self.backingArray countByEnumeratingWithState:state objects:stackbuf count:len];
 
 	if (state->state == 0) {
-		state->state = self.offset;
+		state->state = 1;
+
+		// The index of the next value to enumerate.
+		state->extra[0] = self.offset;
 
 		// Since a sequence doesn't mutate, this just needs to be set to
-		// something non-NULL.
-		state->mutationsPtr = state->extra;
+		// something non-NULL that won't change.
+		state->mutationsPtr = &state->extra[1];
 	}
 
-	state->itemsPtr = stackbuf;
-
-	NSUInteger startIndex = state->state;
-	NSUInteger index = 0;
-
-	for (id value in self.backingArray) {
-		// Constructing an index set for -enumerateObjectsAtIndexes: can actually be
-		// slower than just skipping the items we don't care about.
-		if (index < startIndex) {
-			++index;
-			continue;
-		}
-
-		stackbuf[index - startIndex] = value;
-
-		++index;
-		if (index - startIndex >= len) break;
+	NSUInteger count = self.backingArray.count;
+	NSUInteger index = state->extra[0];
+	if (index >= count) {
+		// Enumeration has completed.
+		return 0;
 	}
 
-	NSCAssert(index > startIndex, @"Final index (%lu) should be greater than start index (%lu)", (unsigned long)index, (unsigned long)startIndex);
+	NSRange range = NSMakeRange(index, MIN(len, count - index));
+	[self.backingArray getObjects:stackbuf range:range];
+
+	state->itemsPtr = stackbuf;
+	state->extra[0] = NSMaxRange(range);
 
-	state->state = index;
-	return index - startIndex;
+	return range.length;
 }
 
 #pragma clang diagnostic push
@@ -8,148 +8,50 @@
 
 #import "RACBlockTrampoline.h"
 #import "RACTuple.h"
+#import "RACmetamacros.h"
+
+// Casts `block` to a block of N object arguments, and calls it directly with
+// the first N values of `arguments`.
+#define RACBlockTrampolineCase(N) \
+	case N: { \
+		id (^typedBlock)(metamacro_for_cxt(N, RACBlockTrampolineParameter,,)) = block; \
+		return typedBlock(metamacro_for_cxt(N, RACBlockTrampolineArgument,,)); \
+	}
 
-@interface RACBlockTrampoline ()
-@property (nonatomic, readonly, copy) id block;
-@end
+#define RACBlockTrampolineParameter(INDEX, CONTEXT) \
+	metamacro_if_eq(0, INDEX)(id)(, id)
+
+#define RACBlockTrampolineArgument(INDEX, CONTEXT) \
+	metamacro_if_eq(0, INDEX)(arguments[0])(, arguments[INDEX])
 
 @implementation RACBlockTrampoline
 
 #pragma mark API
 
-- (instancetype)initWithBlock:(id)block {
-	self = [super init];
-
-	_block = [block copy];
-
-	return self;
-}
-
 + (id)invokeBlock:(id)block withArguments:(RACTuple *)arguments {
 	NSCParameterAssert(block != NULL);
-
-	RACBlockTrampoline *trampoline = [(RACBlockTrampoline *)[self alloc] initWithBlock:block];
-	return [trampoline invokeWithArguments:arguments];
-}
-
-- (id)invokeWithArguments:(RACTuple *)arguments {
-	SEL selector = [self selectorForArgumentCount:arguments.count];
-	NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[self methodSignatureForSelector:selector]];
-	invocation.selector = selector;
-	invocation.target = self;
-
-	for (NSUInteger i = 0; i < arguments.count; i++) {
-		id arg = arguments[i];
-		NSInteger argIndex = (NSInteger)(i + 2);
-		[invocation setArgument:&arg atIndex:argIndex];
-	}
-
-	[invocation invoke];
-	
-	__unsafe_unretained id returnVal;
-	[invocation getReturnValue:&returnVal];
-	return returnVal;
-}
-
-- (SEL)selectorForArgumentCount:(NSUInteger)count {
-	NSCParameterAssert(count > 0);
-
-	switch (count) {
-		case 0: return NULL;
-		case 1: return @selector(performWith:);
-		case 2: return @selector(performWith::);
-		case 3: return @selector(performWith:::);
-		case 4: return @selector(performWith::::);
-		case 5: return @selector(performWith:::::);
-		case 6: return @selector(performWith::::::);
-		case 7: return @selector(performWith:::::::);
-		case 8: return @selector(performWith::::::::);
-		case 9: return @selector(performWith:::::::::);
-		case 10: return @selector(performWith::::::::::);
-		case 11: return @selector(performWith:::::::::::);
-		case 12: return @selector(performWith::::::::::::);
-		case 13: return @selector(performWith:::::::::::::);
-		case 14: return @selector(performWith::::::::::::::);
-		case 15: return @selector(performWith:::::::::::::::);
+	NSCParameterAssert(arguments.count > 0);
+
+	switch (arguments.count) {
+		RACBlockTrampolineCase(1)
+		RACBlockTrampolineCase(2)
+		RACBlockTrampolineCase(3)
+		RACBlockTrampolineCase(4)
+		RACBlockTrampolineCase(5)
+		RACBlockTrampolineCase(6)
+		RACBlockTrampolineCase(7)
+		RACBlockTrampolineCase(8)
+		RACBlockTrampolineCase(9)
+		RACBlockTrampolineCase(10)
+		RACBlockTrampolineCase(11)
+		RACBlockTrampolineCase(12)
+		RACBlockTrampolineCase(13)
+		RACBlockTrampolineCase(14)
+		RACBlockTrampolineCase(15)
 	}
 
 	NSCAssert(NO, @"The argument count is too damn high! Only blocks of up to 15 arguments are currently supported.");
-	return NULL;
-}
-
-- (id)performWith:(id)obj1 {
-	id (^block)(id) = self.block;
-	return block(obj1);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 {
-	id (^block)(id, id) = self.block;
-	return block(obj1, obj2);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 {
-	id (^block)(id, id, id) = self.block;
-	return block(obj1, obj2, obj3);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 {
-	id (^block)(id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 {
-	id (^block)(id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 {
-	id (^block)(id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 {
-	id (^block)(id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 {
-	id (^block)(id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 :(id)obj9 {
-	id (^block)(id, id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8, obj9);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 :(id)obj9 :(id)obj10 {
-	id (^block)(id, id, id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8, obj9, obj10);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 :(id)obj9 :(id)obj10 :(id)obj11 {
-	id (^block)(id, id, id, id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8, obj9, obj10, obj11);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 :(id)obj9 :(id)obj10 :(id)obj11 :(id)obj12 {
-	id (^block)(id, id, id, id, id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8, obj9, obj10, obj11, obj12);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 :(id)obj9 :(id)obj10 :(id)obj11 :(id)obj12 :(id)obj13 {
-	id (^block)(id, id, id, id, id, id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8, obj9, obj10, obj11, obj12, obj13);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 :(id)obj9 :(id)obj10 :(id)obj11 :(id)obj12 :(id)obj13 :(id)obj14 {
-	id (^block)(id, id, id, id, id, id, id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8, obj9, obj10, obj11, obj12, obj13, obj14);
-}
-
-- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 :(id)obj4 :(id)obj5 :(id)obj6 :(id)obj7 :(id)obj8 :(id)obj9 :(id)obj10 :(id)obj11 :(id)obj12 :(id)obj13 :(id)obj14 :(id)obj15 {
-	id (^block)(id, id, id, id, id, id, id, id, id, id, id, id, id, id, id) = self.block;
-	return block(obj1, obj2, obj3, obj4, obj5, obj6, obj7, obj8, obj9, obj10, obj11, obj12, obj13, obj14, obj15);
+	return nil;
 }
 
 @end
@@ -0,0 +1,27 @@
+//
+//  RACConcatSignal.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACSignal.h"
+
+// A private `RACSignal` subclass that sends the values of several signals, one
+// after another.
+//
+// Concatenating onto a RACConcatSignal appends to its list of signals, rather
+// than nesting it, so the values of a long -concat: chain are forwarded to each
+// subscriber directly, and releasing the chain doesn't recurse.
+@interface RACConcatSignal : RACSignal
+
+// Returns a signal which sends the values of `signal`, then those of
+// `nextSignal`.
+//
+// signal     - The signal to subscribe to first. Cannot be nil.
+// nextSignal - The signal to subscribe to once `signal` completes. Cannot be
+//              nil.
++ (RACSignal *)signalByConcatenatingSignal:(RACSignal *)signal withSignal:(RACSignal *)nextSignal;
+
+@end
@@ -0,0 +1,111 @@
+//
+//  RACConcatSignal.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACConcatSignal.h"
+#import "RACCompoundDisposable.h"
+#import "RACScheduler+Private.h"
+#import "RACSerialDisposable.h"
+#import "RACSubscriber.h"
+
+@implementation RACConcatSignal {
+	// The signals to subscribe to, in order. This may be shared with the
+	// signals this one was concatenated from, or onto, each of which only
+	// concatenates the first `_count` of them, so it's only ever appended to.
+	//
+	// This array should only be accessed while synchronized on itself.
+	NSMutableArray<RACSignal *> *_signals;
+
+	// The number of signals in `_signals` that the receiver concatenates.
+	NSUInteger _count;
+}
+
+#pragma mark Lifecycle
+
++ (RACSignal *)signalByConcatenatingSignal:(RACSignal *)signal withSignal:(RACSignal *)nextSignal {
+	NSCParameterAssert(signal != nil);
+	NSCParameterAssert(nextSignal != nil);
+
+	NSMutableArray *signals = nil;
+	NSUInteger count = 0;
+
+	if ([signal isKindOfClass:RACConcatSignal.class]) {
+		RACConcatSignal *concatSignal = (id)signal;
+		count = concatSignal->_count;
+
+		@synchronized (concatSignal->_signals) {
+			// Only the last signal of a chain can append to the shared array.
+			// Any others have to copy their own signals first.
+			if (concatSignal->_signals.count == count) {
+				signals = concatSignal->_signals;
+			} else {
+				signals = [[concatSignal->_signals subarrayWithRange:NSMakeRange(0, count)] mutableCopy];
+			}
+
+			[signals addObject:nextSignal];
+		}
+	} else {
+		signals = [NSMutableArray arrayWithObjects:signal, nextSignal, nil];
+		count = 1;
+	}
+
+	RACConcatSignal *concatSignal = [[self alloc] init];
+	concatSignal->_signals = signals;
+	concatSignal->_count = count + 1;
+	return concatSignal;
+}
+
+#pragma mark Subscription
+
+- (RACDisposable *)subscribe:(id<RACSubscriber>)subscriber {
+	NSCParameterAssert(subscriber != nil);
+
+	RACSerialDisposable *disposable = [[RACSerialDisposable alloc] init];
+	[self subscribe:subscriber toSignalAtIndex:0 disposable:disposable];
+
+	return disposable;
+}
+
+// Subscribes `subscriber` to the signal at `index`, and then to each of the
+// following signals as the one before it completes.
+//
+// Each signal is subscribed to through the subscription scheduler, which
+// trampolines subscriptions once they nest deeply, so that a long chain of
+// signals completing synchronously doesn't overflow the stack.
+- (void)subscribe:(id<RACSubscriber>)subscriber toSignalAtIndex:(NSUInteger)index disposable:(RACSerialDisposable *)disposable {
+	// Replaces the disposable of the previous signal, which has completed.
+	RACCompoundDisposable *signalDisposable = [RACCompoundDisposable compoundDisposable];
+	[disposable swapInDisposable:signalDisposable];
+
+	RACDisposable *schedulingDisposable = [RACScheduler.subscriptionScheduler schedule:^{
+		if (signalDisposable.disposed) return;
+
+		if (index == self->_count) {
+			[subscriber sendCompleted];
+			return;
+		}
+
+		RACSignal *signal = nil;
+		@synchronized (self->_signals) {
+			signal = self->_signals[index];
+		}
+
+		RACDisposable *subscriptionDisposable = [signal subscribeNext:^(id x) {
+			[subscriber sendNext:x];
+		} error:^(NSError *error) {
+			[subscriber sendError:error];
+		} completed:^{
+			[self subscribe:subscriber toSignalAtIndex:index + 1 disposable:disposable];
+		}];
+
+		[signalDisposable addDisposable:subscriptionDisposable];
+	}];
+
+	[signalDisposable addDisposable:schedulingDisposable];
+}
+
+@end
@@ -7,14 +7,17 @@
 //
 
 #import "RACDynamicSequence.h"
-#import <libkern/OSAtomic.h>
 
-// Determines how RACDynamicSequences will be deallocated before the next one is
-// shifted onto the autorelease pool.
+// Whether a RACDynamicSequence is currently being deallocated on this thread.
+static __thread BOOL RACDynamicSequenceDeallocating = NO;
+
+// A retained NSMutableArray of objects whose release has been deferred until
+// the outermost RACDynamicSequence deallocation on this thread gets back to
+// them. Created lazily, so that deallocating a lone sequence doesn't allocate.
 //
-// This avoids stack overflows when deallocating long chains of dynamic
-// sequences.
-#define DEALLOC_OVERFLOW_GUARD 100
+// This keeps deallocating a long chain of sequences from recursing once per
+// node, and so overflowing the stack.
+static __thread CFMutableArrayRef RACDynamicSequenceDeferredReleases = NULL;
 
 @interface RACDynamicSequence () {
 	// The value for the "head" property, if it's been evaluated already.
@@ -114,17 +117,47 @@
 }
 
 - (void)dealloc {
-	static volatile int32_t directDeallocCount = 0;
+	if (RACDynamicSequenceDeallocating) {
+		// Hand anything that may continue the chain to the outermost
+		// deallocation, rather than releasing it from this stack frame.
+		if (_tail != nil || _dependency != nil) {
+			if (RACDynamicSequenceDeferredReleases == NULL) {
+				RACDynamicSequenceDeferredReleases = (__bridge_retained CFMutableArrayRef)[[NSMutableArray alloc] init];
+			}
 
-	if (OSAtomicIncrement32(&directDeallocCount) >= DEALLOC_OVERFLOW_GUARD) {
-		OSAtomicAdd32(-DEALLOC_OVERFLOW_GUARD, &directDeallocCount);
+			NSMutableArray *deferredReleases = (__bridge NSMutableArray *)RACDynamicSequenceDeferredReleases;
+			if (_tail != nil) [deferredReleases addObject:_tail];
+			if (_dependency != nil) [deferredReleases addObject:_dependency];
+		}
 
-		// Put this sequence's tail onto the autorelease pool so we stop
-		// recursing.
-		__autoreleasing RACSequence *tail __attribute__((unused)) = _tail;
+		_tail = nil;
+		_dependency = nil;
+		return;
 	}
-	
+
+	RACDynamicSequenceDeallocating = YES;
+
 	_tail = nil;
+	_dependency = nil;
+
+	// Release deferred objects one at a time, each of which may defer more,
+	// until the whole chain has been torn down.
+	while (RACDynamicSequenceDeferredReleases != NULL) {
+		NSMutableArray *deferredReleases = (__bridge NSMutableArray *)RACDynamicSequenceDeferredReleases;
+		if (deferredReleases.count == 0) {
+			CFRelease(RACDynamicSequenceDeferredReleases);
+			RACDynamicSequenceDeferredReleases = NULL;
+			break;
+		}
+
+		// Take the last reference out of the array before releasing it, so
+		// that the array isn't being mutated if the release defers more.
+		id object = deferredReleases.lastObject;
+		[deferredReleases removeLastObject];
+		object = nil;
+	}
+
+	RACDynamicSequenceDeallocating = NO;
 }
 
 #pragma mark RACSequence
@@ -19,4 +19,8 @@
 
 + (RACSignal *)createSignal:(RACDisposable * (^)(id<RACSubscriber> subscriber))didSubscribe;
 
+// Like +createSignal:, but subscriptions made without a +[RACScheduler
+// currentScheduler] follow `policy` instead of always inheriting it.
++ (RACSignal *)createSignal:(RACDisposable * (^)(id<RACSubscriber> subscriber))didSubscribe subscriptionPolicy:(RACSubscriptionPolicy)policy;
+
 @end
@@ -12,6 +12,7 @@
 #import "RACPassthroughSubscriber.h"
 #import "RACScheduler+Private.h"
 #import "RACSubscriber.h"
+#import "RACSubscriptionScheduler.h"
 #import <libkern/OSAtomic.h>
 
 @interface RACDynamicSignal ()
@@ -19,6 +20,9 @@
 // The block to invoke for each subscriber.
 @property (nonatomic, copy, readonly) RACDisposable * (^ didSubscribe)(id<RACSubscriber> subscriber);
 
+// How to subscribe when there's no +[RACScheduler currentScheduler].
+@property (nonatomic, assign, readonly) RACSubscriptionPolicy subscriptionPolicy;
+
 @end
 
 @implementation RACDynamicSignal
@@ -36,6 +40,13 @@
      */
 }
 
++ (RACSignal *)createSignal:(RACDisposable * (^)(id<RACSubscriber> subscriber))didSubscribe subscriptionPolicy:(RACSubscriptionPolicy)policy {
+    RACDynamicSignal *signal = [[self alloc] init];
+    signal->_didSubscribe = [didSubscribe copy];
+    signal->_subscriptionPolicy = policy;
+    return [signal setNameWithFormat:@"+createSignal:subscriptionPolicy: %ld", (long)policy];
+}
+
 #pragma mark Managing Subscribers
 
 - (RACDisposable *)subscribe:(id<RACSubscriber>)subscriber {
@@ -57,7 +68,8 @@
 
     if (self.didSubscribe != NULL) {
         // self.didSubscribe 即 创建信号时传入的signal->_didSubscribe = [didSubscribe copy];
-        RACDisposable *schedulingDisposable = [RACScheduler.subscriptionScheduler schedule:^{
+        RACSubscriptionScheduler *subscriptionScheduler = (RACSubscriptionScheduler *)RACScheduler.subscriptionScheduler;
+        RACDisposable *schedulingDisposable = [subscriptionScheduler schedule:^{
             RACDisposable *innerDisposable = self.didSubscribe(subscriber);
             /*
              1.执行disSubscribe block
@@ -67,7 +79,7 @@
             */
             
             [disposable addDisposable:innerDisposable];
-        }];
+        } policy:self.subscriptionPolicy];
 
         [disposable addDisposable:schedulingDisposable];
         /*
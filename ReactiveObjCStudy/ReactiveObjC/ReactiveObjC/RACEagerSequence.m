@@ -9,6 +9,7 @@
 #import "RACEagerSequence.h"
 #import "NSObject+RACDescription.h"
 #import "RACArraySequence.h"
+#import "RACFusedSequence.h"
 
 @implementation RACEagerSequence
 
@@ -47,6 +48,13 @@
 	return [[self.class sequenceWithArray:array offset:0] setNameWithFormat:@"[%@] -concat: %@", self.name, sequence];
 }
 
+#pragma mark Fusion
+
+- (RACSequence *)sequenceByFusingStage:(RACFusedSequenceStep (^)(void))stage {
+	NSArray *array = [RACFusedSequence sequenceWithSequence:self stage:stage].array;
+	return [self.class sequenceWithArray:array offset:0];
+}
+
 #pragma mark Extended methods
 
 - (RACSequence *)eagerSequence {
@@ -0,0 +1,84 @@
+//
+//  RACEventLoopScheduler.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACScheduler.h"
+#import "RACSignal.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// A serial scheduler which runs a kqueue event loop on a dedicated thread.
+//
+// Besides executing scheduled blocks, the loop can watch any number of file
+// descriptors for readiness, so that many sockets or pipes can be multiplexed
+// onto one thread without blocking it. Scheduled blocks, timers, and readiness
+// handlers all execute on the loop's thread, with the receiver as the current
+// scheduler.
+//
+// The loop's thread is never torn down, so a scheduler should be created once
+// and kept for the life of the process.
+@interface RACEventLoopScheduler : RACScheduler
+
+// Initializes the receiver and starts its event loop.
+//
+// name - The name of the scheduler, also used to name its thread. If nil, a
+//        default name will be used.
+//
+// Returns the initialized object.
+- (instancetype)initWithName:(nullable NSString *)name;
+
+// Invokes a handler on the event loop whenever the given file descriptor is
+// ready for reading or writing.
+//
+// Readiness is level-triggered, so the handler will be invoked again on the
+// next turn of the loop unless it reads or writes until the descriptor is no
+// longer ready. Any number of handlers may watch the same descriptor.
+//
+// fileDescriptor - The descriptor to watch. This must remain open until the
+//                  returned disposable has been disposed.
+// writing        - Whether to watch for writability, rather than readability.
+// handler        - Invoked on the event loop with the number of bytes which
+//                  can be read from the descriptor or written to it, whether
+//                  the other end has been closed, and any error which occurred
+//                  while watching the descriptor. After an error, the handler
+//                  is not invoked again. Cannot be nil.
+//
+// Returns a disposable which stops watching the descriptor.
+- (RACDisposable *)watchFileDescriptor:(int)fileDescriptor forWriting:(BOOL)writing handler:(void (^)(NSUInteger available, BOOL endOfFile, NSError * _Nullable error))handler;
+
+@end
+
+@interface RACSignal (RACEventLoopScheduler)
+
+// Returns a signal which sends the number of bytes which can be read from the
+// given file descriptor whenever it is ready for reading.
+//
+// Values are delivered on the event loop of `scheduler`, where subscribers can
+// read from the descriptor without blocking. The signal completes once the
+// other end has been closed and all remaining data has been announced, and
+// errors if the descriptor cannot be watched.
+//
+// fileDescriptor - The descriptor to watch. This must remain open for as long
+//                  as the signal has subscribers.
+// scheduler      - The event loop to watch the descriptor on. Cannot be nil.
++ (RACSignal<NSNumber *> *)readableSignalForFileDescriptor:(int)fileDescriptor onScheduler:(RACEventLoopScheduler *)scheduler RAC_WARN_UNUSED_RESULT;
+
+// Returns a signal which sends the amount of buffer space available whenever
+// the given file descriptor is ready for writing.
+//
+// Values are delivered on the event loop of `scheduler`. The signal completes
+// once the reading end has been closed, and errors if the descriptor cannot be
+// watched.
+//
+// fileDescriptor - The descriptor to watch. This must remain open for as long
+//                  as the signal has subscribers.
+// scheduler      - The event loop to watch the descriptor on. Cannot be nil.
++ (RACSignal<NSNumber *> *)writableSignalForFileDescriptor:(int)fileDescriptor onScheduler:(RACEventLoopScheduler *)scheduler RAC_WARN_UNUSED_RESULT;
+
+@end
+
+NS_ASSUME_NONNULL_END
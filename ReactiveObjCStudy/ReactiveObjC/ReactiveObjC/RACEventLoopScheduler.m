@@ -0,0 +1,372 @@
+//
+//  RACEventLoopScheduler.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACEventLoopScheduler.h"
+#import "RACCompoundDisposable.h"
+#import "RACDisposable.h"
+#import "RACScheduler+Private.h"
+#import "RACSubscriber.h"
+#import <pthread.h>
+#import <sys/event.h>
+
+// The identifier of the EVFILT_USER event used to wake the loop when blocks
+// are enqueued.
+static const uintptr_t RACEventLoopWakeUpIdentifier = 0;
+
+// The maximum number of events to dequeue from the kqueue at once.
+static const int RACEventLoopEventBatchSize = 64;
+
+typedef void (^RACEventLoopHandler)(NSUInteger available, BOOL endOfFile, NSError *error);
+
+@implementation RACEventLoopScheduler {
+	int _kqueue;
+
+	// Protects _blocks.
+	pthread_mutex_t _mutex;
+
+	// Blocks waiting to be executed, in order.
+	NSMutableArray *_blocks;
+
+	// The handlers watching each file descriptor, keyed by descriptor. Only
+	// accessed on the loop thread.
+	NSMutableDictionary<NSNumber *, NSMutableArray<RACEventLoopHandler> *> *_readHandlers;
+	NSMutableDictionary<NSNumber *, NSMutableArray<RACEventLoopHandler> *> *_writeHandlers;
+
+	// The blocks to invoke for each active timer, keyed by identifier. Only
+	// accessed on the loop thread.
+	NSMutableDictionary<NSNumber *, void (^)(void)> *_timers;
+	uintptr_t _nextTimerIdentifier;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithName:(NSString *)name {
+	if (name == nil) name = @"org.reactivecocoa.ReactiveObjC.RACEventLoopScheduler";
+
+	self = [super initWithName:name];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	_kqueue = kqueue();
+	NSCAssert(_kqueue >= 0, @"Failed to create kqueue with error %d", errno);
+
+	struct kevent wakeUp;
+	EV_SET(&wakeUp, RACEventLoopWakeUpIdentifier, EVFILT_USER, EV_ADD | EV_CLEAR, 0, 0, NULL);
+	kevent(_kqueue, &wakeUp, 1, NULL, 0, NULL);
+
+	_blocks = [[NSMutableArray alloc] init];
+	_readHandlers = [[NSMutableDictionary alloc] init];
+	_writeHandlers = [[NSMutableDictionary alloc] init];
+	_timers = [[NSMutableDictionary alloc] init];
+	_nextTimerIdentifier = 1;
+
+	NSThread *thread = [[NSThread alloc] initWithBlock:^{
+		[self run];
+	}];
+
+	thread.name = name;
+	[thread start];
+
+	return self;
+}
+
+- (void)dealloc {
+	close(_kqueue);
+
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+#pragma mark Event Loop
+
+- (void)run {
+	struct kevent events[RACEventLoopEventBatchSize];
+
+	while (YES) {
+		@autoreleasepool {
+			int count = kevent(_kqueue, NULL, 0, events, RACEventLoopEventBatchSize, NULL);
+			if (count < 0) {
+				NSCAssert(errno == EINTR, @"Failed to wait for kqueue events with error %d", errno);
+				continue;
+			}
+
+			[self performAsCurrentScheduler:^{
+				for (int i = 0; i < count; i++) {
+					[self handleEvent:&events[i]];
+				}
+			}];
+		}
+	}
+}
+
+- (void)handleEvent:(const struct kevent *)event {
+	switch (event->filter) {
+		case EVFILT_USER:
+			[self drainBlocks];
+			break;
+
+		case EVFILT_TIMER: {
+			// The timer may have been cancelled earlier in this batch.
+			void (^block)(void) = _timers[@(event->ident)];
+			if (block != nil) block();
+			break;
+		}
+
+		case EVFILT_READ:
+		case EVFILT_WRITE: {
+			NSMutableDictionary *handlersByDescriptor = (event->filter == EVFILT_READ ? _readHandlers : _writeHandlers);
+			NSNumber *key = @(event->ident);
+
+			NSError *error = nil;
+			if ((event->flags & EV_ERROR) != 0) {
+				error = [NSError errorWithDomain:NSPOSIXErrorDomain code:(NSInteger)event->data userInfo:nil];
+
+				// kqueue has already dropped the registration.
+				[handlersByDescriptor removeObjectForKey:key];
+			}
+
+			BOOL endOfFile = (event->flags & EV_EOF) != 0;
+			NSUInteger available = (event->data > 0 && error == nil ? (NSUInteger)event->data : 0);
+
+			// Copy the handlers, since they may stop watching while being
+			// invoked.
+			NSArray *handlers = [handlersByDescriptor[key] copy];
+			for (RACEventLoopHandler handler in handlers) {
+				handler(available, endOfFile, error);
+			}
+
+			break;
+		}
+
+		default:
+			break;
+	}
+}
+
+- (void)drainBlocks {
+	pthread_mutex_lock(&_mutex);
+	NSArray *blocks = _blocks;
+	_blocks = [[NSMutableArray alloc] init];
+	pthread_mutex_unlock(&_mutex);
+
+	for (void (^block)(void) in blocks) {
+		block();
+	}
+}
+
+- (void)enqueue:(void (^)(void))block {
+	pthread_mutex_lock(&_mutex);
+
+	[_blocks addObject:[block copy]];
+	BOOL shouldWakeUp = (_blocks.count == 1);
+
+	pthread_mutex_unlock(&_mutex);
+
+	if (shouldWakeUp) {
+		struct kevent wakeUp;
+		EV_SET(&wakeUp, RACEventLoopWakeUpIdentifier, EVFILT_USER, 0, NOTE_TRIGGER, 0, NULL);
+		kevent(_kqueue, &wakeUp, 1, NULL, 0, NULL);
+	}
+}
+
+#pragma mark Timers
+
+// Registers a timer with the kqueue.
+//
+// This must only be invoked on the loop thread.
+- (void)setTimer:(uintptr_t)identifier afterNanoseconds:(int64_t)nanoseconds repeating:(BOOL)repeating {
+	struct kevent timer;
+	EV_SET(&timer, identifier, EVFILT_TIMER, EV_ADD | (repeating ? 0 : EV_ONESHOT), NOTE_NSECONDS, MAX(nanoseconds, 0), NULL);
+	kevent(_kqueue, &timer, 1, NULL, 0, NULL);
+}
+
+// Removes a timer registered with -setTimer:afterNanoseconds:repeating:.
+//
+// This must only be invoked on the loop thread.
+- (void)cancelTimer:(uintptr_t)identifier {
+	if (_timers[@(identifier)] == nil) return;
+
+	[_timers removeObjectForKey:@(identifier)];
+
+	struct kevent timer;
+	EV_SET(&timer, identifier, EVFILT_TIMER, EV_DELETE, 0, 0, NULL);
+	kevent(_kqueue, &timer, 1, NULL, 0, NULL);
+}
+
+#pragma mark File Descriptors
+
+- (RACDisposable *)watchFileDescriptor:(int)fileDescriptor forWriting:(BOOL)writing handler:(void (^)(NSUInteger available, BOOL endOfFile, NSError *error))handler {
+	NSCParameterAssert(fileDescriptor >= 0);
+	NSCParameterAssert(handler != nil);
+
+	RACEventLoopHandler copiedHandler = [handler copy];
+	int16_t filter = (writing ? EVFILT_WRITE : EVFILT_READ);
+	NSNumber *key = @(fileDescriptor);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+
+	[self enqueue:^{
+		if (disposable.disposed) return;
+
+		NSMutableDictionary *handlersByDescriptor = (writing ? self->_writeHandlers : self->_readHandlers);
+		NSMutableArray *handlers = handlersByDescriptor[key];
+
+		if (handlers == nil) {
+			struct kevent registration;
+			EV_SET(&registration, (uintptr_t)fileDescriptor, filter, EV_ADD, 0, 0, NULL);
+
+			if (kevent(self->_kqueue, &registration, 1, NULL, 0, NULL) < 0) {
+				copiedHandler(0, NO, [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil]);
+				return;
+			}
+
+			handlers = [[NSMutableArray alloc] init];
+			handlersByDescriptor[key] = handlers;
+		}
+
+		[handlers addObject:copiedHandler];
+	}];
+
+	return [RACDisposable disposableWithBlock:^{
+		[disposable dispose];
+
+		[self enqueue:^{
+			NSMutableDictionary *handlersByDescriptor = (writing ? self->_writeHandlers : self->_readHandlers);
+			NSMutableArray *handlers = handlersByDescriptor[key];
+
+			[handlers removeObjectIdenticalTo:copiedHandler];
+			if (handlers == nil || handlers.count > 0) return;
+
+			[handlersByDescriptor removeObjectForKey:key];
+
+			// This may fail if the descriptor has already been closed, which
+			// removes it from the kqueue anyway.
+			struct kevent registration;
+			EV_SET(&registration, (uintptr_t)fileDescriptor, filter, EV_DELETE, 0, 0, NULL);
+			kevent(self->_kqueue, &registration, 1, NULL, 0, NULL);
+		}];
+	}];
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+
+	[self enqueue:^{
+		if (disposable.disposed) return;
+		block();
+	}];
+
+	return disposable;
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != NULL);
+
+	return [self after:date repeatingEvery:0 schedule:block];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(interval > 0.0 && interval < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(leeway >= 0.0 && leeway < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(block != NULL);
+
+	// kqueue timers don't support leeway, so it is ignored.
+	return [self after:date repeatingEvery:interval schedule:block];
+}
+
+// Registers a timer which first fires at `date`, and then every `interval`
+// seconds if `interval` is greater than zero.
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval schedule:(void (^)(void))block {
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+	__block uintptr_t identifier = 0;
+
+	block = [block copy];
+
+	[self enqueue:^{
+		if (disposable.disposed) return;
+
+		identifier = self->_nextTimerIdentifier++;
+
+		// The first firing is one-shot, and repeating timers are rearmed with
+		// their interval afterward, since kqueue timers can't have a separate
+		// start time.
+		__block BOOL rearmed = NO;
+		self->_timers[@(identifier)] = ^{
+			if (interval <= 0) {
+				[self cancelTimer:identifier];
+			} else if (!rearmed) {
+				rearmed = YES;
+				[self setTimer:identifier afterNanoseconds:(int64_t)(interval * NSEC_PER_SEC) repeating:YES];
+			}
+
+			block();
+		};
+
+		[self setTimer:identifier afterNanoseconds:(int64_t)(date.timeIntervalSinceNow * NSEC_PER_SEC) repeating:NO];
+	}];
+
+	return [RACDisposable disposableWithBlock:^{
+		[disposable dispose];
+
+		[self enqueue:^{
+			if (identifier != 0) [self cancelTimer:identifier];
+		}];
+	}];
+}
+
+@end
+
+@implementation RACSignal (RACEventLoopScheduler)
+
++ (RACSignal *)signalForFileDescriptor:(int)fileDescriptor forWriting:(BOOL)writing onScheduler:(RACEventLoopScheduler *)scheduler {
+	NSCParameterAssert(fileDescriptor >= 0);
+	NSCParameterAssert(scheduler != nil);
+
+	return [RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
+
+		RACDisposable *watchDisposable = [scheduler watchFileDescriptor:fileDescriptor forWriting:writing handler:^(NSUInteger available, BOOL endOfFile, NSError *error) {
+			if (disposable.disposed) return;
+
+			if (error != nil) {
+				[subscriber sendError:error];
+				return;
+			}
+
+			// Readers still need to consume any data which arrived before the
+			// other end was closed.
+			if (!writing && available > 0) [subscriber sendNext:@(available)];
+
+			if (endOfFile) {
+				[subscriber sendCompleted];
+			} else if (writing) {
+				[subscriber sendNext:@(available)];
+			}
+		}];
+
+		[disposable addDisposable:watchDisposable];
+		return disposable;
+	}];
+}
+
++ (RACSignal *)readableSignalForFileDescriptor:(int)fileDescriptor onScheduler:(RACEventLoopScheduler *)scheduler {
+	return [[self signalForFileDescriptor:fileDescriptor forWriting:NO onScheduler:scheduler] setNameWithFormat:@"+readableSignalForFileDescriptor: %d onScheduler: %@", fileDescriptor, scheduler];
+}
+
++ (RACSignal *)writableSignalForFileDescriptor:(int)fileDescriptor onScheduler:(RACEventLoopScheduler *)scheduler {
+	return [[self signalForFileDescriptor:fileDescriptor forWriting:YES onScheduler:scheduler] setNameWithFormat:@"+writableSignalForFileDescriptor: %d onScheduler: %@", fileDescriptor, scheduler];
+}
+
+@end
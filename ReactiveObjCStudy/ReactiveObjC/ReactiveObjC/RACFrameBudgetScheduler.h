@@ -0,0 +1,60 @@
+//
+//  RACFrameBudgetScheduler.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACScheduler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// A serial scheduler which only executes blocks for a limited time in every
+// frame.
+//
+// Time is divided into frames of `frameInterval` seconds. Within each frame,
+// the scheduler executes pending blocks until it has spent `budget` seconds
+// doing so, and then leaves its queue alone until the next frame begins. This
+// keeps a latency-sensitive queue, such as the main queue, responsive even
+// while a large amount of work is pushed through the scheduler.
+//
+// Each scheduler also has an idle lane, exposed as `idleScheduler`. Blocks on
+// the idle lane share the same frame budget, but are only executed while the
+// receiver itself has no blocks pending.
+//
+// At least one block is executed in every frame which has work pending, so a
+// single block which takes longer than the budget delays, but does not stall,
+// the rest of the queue.
+@interface RACFrameBudgetScheduler : RACScheduler
+
+// The length of each frame, in seconds.
+@property (nonatomic, assign, readonly) NSTimeInterval frameInterval;
+
+// The time which may be spent executing blocks in each frame, in seconds.
+@property (nonatomic, assign, readonly) NSTimeInterval budget;
+
+// A serial scheduler for low-priority blocks, which are only executed when the
+// receiver has no other blocks pending.
+//
+// The idle scheduler shares the receiver's serial context, so its blocks never
+// execute concurrently with the receiver's.
+@property (nonatomic, strong, readonly) RACScheduler *idleScheduler;
+
+// Initializes the receiver.
+//
+// name          - The name of the scheduler. If nil, a default name will be
+//                 used.
+// targetQueue   - The queue which blocks are executed on. Cannot be NULL.
+// frameInterval - The length of each frame, in seconds. Must be greater than
+//                 zero.
+// budget        - The time which may be spent executing blocks in each frame.
+//                 Must be greater than zero, and no greater than
+//                 `frameInterval`.
+//
+// Returns the initialized object.
+- (instancetype)initWithName:(nullable NSString *)name targetQueue:(dispatch_queue_t)targetQueue frameInterval:(NSTimeInterval)frameInterval budget:(NSTimeInterval)budget;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,282 @@
+//
+//  RACFrameBudgetScheduler.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACFrameBudgetScheduler.h"
+#import "RACScheduler+Private.h"
+#import "RACScheduler+Subclass.h"
+#import <pthread.h>
+
+// The scheduler for the idle lane of a RACFrameBudgetScheduler.
+@interface RACFrameBudgetIdleScheduler : RACScheduler
+
+// The scheduler whose idle lane this is.
+@property (nonatomic, strong, readonly) RACFrameBudgetScheduler *scheduler;
+
+- (instancetype)initWithScheduler:(RACFrameBudgetScheduler *)scheduler;
+
+@end
+
+@interface RACFrameBudgetScheduler ()
+
+// The serial queue on which frames are executed.
+@property (nonatomic, strong, readonly) dispatch_queue_t queue;
+
+// The name the receiver was initialized with, or its default name.
+@property (nonatomic, copy, readonly) NSString *schedulerName;
+
+// Adds the given block to the end of a lane.
+//
+// block - The block to enqueue, which must already have been wrapped to
+//         execute as the current scheduler of its lane.
+// idle  - Whether to add the block to the idle lane.
+- (void)enqueue:(void (^)(void))block idle:(BOOL)idle;
+
+// Implements the RACScheduler methods for both lanes.
+//
+// lane - The scheduler which the block should execute as. This must be the
+//        receiver or its idle scheduler.
+- (RACDisposable *)schedule:(void (^)(void))block onLane:(RACScheduler *)lane;
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block onLane:(RACScheduler *)lane;
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block onLane:(RACScheduler *)lane;
+
+@end
+
+@implementation RACFrameBudgetScheduler {
+	// Protects everything below.
+	pthread_mutex_t _mutex;
+
+	// Blocks waiting to be executed on each lane, in order.
+	NSMutableArray *_blocks;
+	NSMutableArray *_idleBlocks;
+
+	// Whether a frame has been submitted to `queue` and not yet finished.
+	BOOL _frameScheduled;
+
+	// The time at which the current frame began, in nanoseconds.
+	uint64_t _frameStart;
+
+	// The time spent executing blocks in the current frame, in nanoseconds.
+	uint64_t _frameSpent;
+
+	uint64_t _frameInterval;
+	uint64_t _budget;
+
+	// The idle scheduler, held weakly since it retains the receiver.
+	__weak RACFrameBudgetIdleScheduler *_idleScheduler;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithName:(NSString *)name targetQueue:(dispatch_queue_t)targetQueue frameInterval:(NSTimeInterval)frameInterval budget:(NSTimeInterval)budget {
+	NSCParameterAssert(targetQueue != NULL);
+	NSCParameterAssert(frameInterval > 0.0 && frameInterval < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(budget > 0.0 && budget <= frameInterval);
+
+	if (name == nil) name = @"org.reactivecocoa.ReactiveObjC.RACFrameBudgetScheduler";
+
+	self = [super initWithName:name];
+
+	_schedulerName = [name copy];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	_blocks = [[NSMutableArray alloc] init];
+	_idleBlocks = [[NSMutableArray alloc] init];
+
+	_frameInterval = (uint64_t)(frameInterval * NSEC_PER_SEC);
+	_budget = (uint64_t)(budget * NSEC_PER_SEC);
+
+	dispatch_queue_t queue = dispatch_queue_create(name.UTF8String, DISPATCH_QUEUE_SERIAL);
+	dispatch_set_target_queue(queue, targetQueue);
+	_queue = queue;
+
+	return self;
+}
+
+- (void)dealloc {
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+#pragma mark Properties
+
+- (NSTimeInterval)frameInterval {
+	return (NSTimeInterval)_frameInterval / NSEC_PER_SEC;
+}
+
+- (NSTimeInterval)budget {
+	return (NSTimeInterval)_budget / NSEC_PER_SEC;
+}
+
+- (RACScheduler *)idleScheduler {
+	pthread_mutex_lock(&_mutex);
+
+	RACFrameBudgetIdleScheduler *idleScheduler = _idleScheduler;
+	if (idleScheduler == nil) {
+		idleScheduler = [[RACFrameBudgetIdleScheduler alloc] initWithScheduler:self];
+		_idleScheduler = idleScheduler;
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	return idleScheduler;
+}
+
+#pragma mark Frames
+
+// Submits a frame to `queue`, starting it immediately if the current frame
+// still has budget remaining, or at the start of the next frame otherwise.
+//
+// This must be invoked with _mutex held.
+- (void)scheduleFrame {
+	_frameScheduled = YES;
+
+	uint64_t now = RACMonotonicTime();
+	uint64_t nextFrameStart = _frameStart + _frameInterval;
+
+	void (^frame)(void) = ^{
+		[self performFrame];
+	};
+
+	if (_frameSpent < _budget || now >= nextFrameStart) {
+		dispatch_async(self.queue, frame);
+	} else {
+		dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(nextFrameStart - now)), self.queue, frame);
+	}
+}
+
+- (void)performFrame {
+	pthread_mutex_lock(&_mutex);
+
+	uint64_t start = RACMonotonicTime();
+	if (start >= _frameStart + _frameInterval) {
+		_frameStart = start;
+		_frameSpent = 0;
+	}
+
+	if (_frameSpent >= _budget) {
+		// Another frame was submitted before this one used up the budget.
+		[self scheduleFrame];
+		pthread_mutex_unlock(&_mutex);
+		return;
+	}
+
+	uint64_t deadline = start + (_budget - _frameSpent);
+
+	while (YES) {
+		NSMutableArray *blocks = (_blocks.count > 0 ? _blocks : _idleBlocks);
+		void (^block)(void) = blocks.firstObject;
+		if (block == nil) break;
+
+		[blocks removeObjectAtIndex:0];
+		pthread_mutex_unlock(&_mutex);
+
+		@autoreleasepool {
+			block();
+		}
+
+		uint64_t now = RACMonotonicTime();
+
+		pthread_mutex_lock(&_mutex);
+		if (now >= deadline) break;
+	}
+
+	_frameSpent += RACMonotonicTime() - start;
+	_frameScheduled = NO;
+
+	if (_blocks.count > 0 || _idleBlocks.count > 0) [self scheduleFrame];
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+- (void)enqueue:(void (^)(void))block idle:(BOOL)idle {
+	pthread_mutex_lock(&_mutex);
+
+	[(idle ? _idleBlocks : _blocks) addObject:[block copy]];
+	if (!_frameScheduled) [self scheduleFrame];
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+#pragma mark Lanes
+
+- (RACDisposable *)schedule:(void (^)(void))block onLane:(RACScheduler *)lane {
+	NSCParameterAssert(block != NULL);
+
+	return [self schedule:^{
+		[lane performAsCurrentScheduler:block];
+	} enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock idle:(lane != self)];
+	}];
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block onLane:(RACScheduler *)lane {
+	NSCParameterAssert(block != NULL);
+
+	return [self after:date schedule:^{
+		[lane performAsCurrentScheduler:block];
+	} timerQueue:self.queue enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock idle:(lane != self)];
+	}];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block onLane:(RACScheduler *)lane {
+	NSCParameterAssert(block != NULL);
+
+	return [self after:date repeatingEvery:interval withLeeway:leeway schedule:^{
+		[lane performAsCurrentScheduler:block];
+	} timerQueue:self.queue enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock idle:(lane != self)];
+	}];
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	return [self schedule:block onLane:self];
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	return [self after:date schedule:block onLane:self];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	return [self after:date repeatingEvery:interval withLeeway:leeway schedule:block onLane:self];
+}
+
+@end
+
+@implementation RACFrameBudgetIdleScheduler
+
+- (instancetype)initWithScheduler:(RACFrameBudgetScheduler *)scheduler {
+	NSCParameterAssert(scheduler != nil);
+
+	NSString *name = scheduler.schedulerName;
+	self = [super initWithName:(name != nil ? [name stringByAppendingString:@".idle"] : nil)];
+
+	_scheduler = scheduler;
+
+	return self;
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	return [self.scheduler schedule:block onLane:self];
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	return [self.scheduler after:date schedule:block onLane:self];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	return [self.scheduler after:date repeatingEvery:interval withLeeway:leeway schedule:block onLane:self];
+}
+
+@end
@@ -0,0 +1,61 @@
+//
+//  RACFusedSequence.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACSequence.h"
+
+// A single step of a fused pipeline.
+//
+// value - The value produced by the previous step, or by the source sequence.
+//         This will never be nil.
+// stop  - Set to YES to end the sequence after the current value.
+//
+// Returns the value to pass on to the next step, or nil to drop `value`.
+typedef id (^RACFusedSequenceStep)(id value, BOOL *stop);
+
+// Private class that applies a chain of element-wise operators, like -map: and
+// -filter:, to a source sequence in a single pass.
+//
+// Values are pulled from the source one at a time and passed through every
+// step in turn, without creating any intermediate sequences. The results are
+// memoized in a buffer which the sequence and all of its tails share, so every
+// step is evaluated at most once per value, no matter how the sequence is
+// consumed.
+//
+// A pipeline over a RACStreamingSequence is instead a streaming sequence
+// itself, which doesn't memoize its values.
+@interface RACFusedSequence : RACSequence
+
+// Returns a sequence which applies a step to each value of `sequence`.
+//
+// If `sequence` is itself a RACFusedSequence which hasn't been evaluated yet,
+// the step is appended to its pipeline, rather than wrapping it.
+//
+// If `sequence` is a RACStreamingSequence, the result is a single-pass
+// RACStreamingSequence, which hands each value out exactly once without
+// memoizing it. Pipelines over the same streaming source are fused in the same
+// way until their first value is requested.
+//
+// sequence - The sequence to apply the step to. Cannot be nil.
+// stage    - Returns a new step, with its own state, each time the pipeline is
+//            evaluated. Cannot be nil.
++ (RACSequence *)sequenceWithSequence:(RACSequence *)sequence stage:(RACFusedSequenceStep (^)(void))stage;
+
+@end
+
+@interface RACSequence (RACFusedSequence)
+
+// Returns a sequence which applies a step to each value of the receiver.
+//
+// By default, this returns a lazy RACFusedSequence. Eager sequences override
+// this to evaluate the pipeline immediately.
+//
+// stage - Returns a new step, with its own state, each time the pipeline is
+//         evaluated. Cannot be nil.
+- (RACSequence *)sequenceByFusingStage:(RACFusedSequenceStep (^)(void))stage;
+
+@end
@@ -0,0 +1,463 @@
+//
+//  RACFusedSequence.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACFusedSequence.h"
+#import "RACArraySequence.h"
+#import "RACStreamingSequence.h"
+#import "RACStringSequence.h"
+#import "RACTupleSequence.h"
+#import <pthread.h>
+
+// The number of values to fetch from a source at once, when using fast
+// enumeration.
+static const NSUInteger RACFusedSequenceBufferSize = 16;
+
+// Pulls values from a source sequence through a pipeline of steps.
+//
+// An iterator is single-use, and must not be used from multiple threads at
+// once.
+@interface RACFusedSequenceIterator : NSObject
+
+- (instancetype)initWithSource:(RACSequence *)source steps:(NSArray<RACFusedSequenceStep> *)steps;
+
+// Returns the next value produced by the pipeline, or nil once the pipeline is
+// exhausted.
+- (id)nextObject;
+
+@end
+
+@implementation RACFusedSequenceIterator {
+	// The remainder of the source. When enumerating quickly, this is instead
+	// the whole source, kept alive for the sake of the values in _state.
+	RACSequence *_source;
+
+	NSArray<RACFusedSequenceStep> *_steps;
+
+	// Whether to fetch values from _source using fast enumeration, which is
+	// only safe to abandon part way through for sequences which enumerate
+	// their backing storage directly.
+	BOOL _usesFastEnumeration;
+
+	// Whether to fetch values from _source using -nextObject, so that a
+	// streaming source isn't memoized by walking its -tail.
+	BOOL _usesStreaming;
+
+	NSFastEnumerationState _state;
+	__unsafe_unretained id _stackbuf[RACFusedSequenceBufferSize];
+
+	// The values most recently fetched using fast enumeration. These are
+	// retained here, since sources may hand out values which only their
+	// autorelease pool keeps alive, and the pool can drain between calls to
+	// -nextObject.
+	__strong id _buffer[RACFusedSequenceBufferSize];
+	NSUInteger _bufferCount;
+	NSUInteger _bufferIndex;
+
+	// Whether a step has ended the pipeline, or the source has been exhausted.
+	BOOL _finished;
+}
+
+- (instancetype)initWithSource:(RACSequence *)source steps:(NSArray<RACFusedSequenceStep> *)steps {
+	self = [super init];
+
+	_source = source;
+	_steps = [steps copy];
+	_usesFastEnumeration = [source isKindOfClass:RACArraySequence.class] || [source isKindOfClass:RACTupleSequence.class] || [source isKindOfClass:RACStringSequence.class];
+	_usesStreaming = [source isKindOfClass:RACStreamingSequence.class];
+
+	return self;
+}
+
+- (id)nextSourceValue {
+	if (_usesFastEnumeration) {
+		if (_bufferIndex >= _bufferCount) {
+			_bufferIndex = 0;
+			_bufferCount = [_source countByEnumeratingWithState:&_state objects:_stackbuf count:RACFusedSequenceBufferSize];
+
+			for (NSUInteger i = 0; i < _bufferCount; i++) {
+				_buffer[i] = _state.itemsPtr[i];
+			}
+
+			if (_bufferCount == 0) return nil;
+		}
+
+		// Hand over the reference, so that the buffer doesn't keep the value
+		// alive any longer than the pipeline does.
+		id value = _buffer[_bufferIndex];
+		_buffer[_bufferIndex++] = nil;
+		return value;
+	}
+
+	if (_usesStreaming) return [(RACStreamingSequence *)_source nextObject];
+
+	id value = _source.head;
+	if (value == nil) return nil;
+
+	_source = _source.tail;
+	return value;
+}
+
+- (id)nextObject {
+	while (!_finished) {
+		id value = [self nextSourceValue];
+		if (value == nil) {
+			_finished = YES;
+			break;
+		}
+
+		BOOL stop = NO;
+		for (RACFusedSequenceStep step in _steps) {
+			value = step(value, &stop);
+			if (value == nil) break;
+		}
+
+		if (stop) _finished = YES;
+		if (value != nil) return value;
+	}
+
+	// Release the source as soon as possible.
+	_source = nil;
+	return nil;
+}
+
+@end
+
+// Returns a new instance of each step of a pipeline, with its own state.
+static NSArray<RACFusedSequenceStep> *RACFusedSequenceSteps(NSArray<RACFusedSequenceStep (^)(void)> *stages) {
+	NSMutableArray *steps = [NSMutableArray arrayWithCapacity:stages.count];
+	for (RACFusedSequenceStep (^stage)(void) in stages) {
+		[steps addObject:[stage() copy]];
+	}
+
+	return steps;
+}
+
+// Memoizes the values produced by an iterator, for every node of a
+// RACFusedSequence to share.
+//
+// Values are only pulled from the iterator when a node first asks for them, so
+// each step of the pipeline is evaluated at most once per value, whichever
+// node or consumer asks first.
+@interface RACFusedSequenceBuffer : NSObject
+
+// Whether any value has been requested from the receiver yet.
+@property (atomic, assign, readonly, getter = isStarted) BOOL started;
+
+// Initializes the receiver to pull from a new instance of the given pipeline.
+- (instancetype)initWithSource:(RACSequence *)source stages:(NSArray<RACFusedSequenceStep (^)(void)> *)stages;
+
+// Returns the value at `index`, or nil if the pipeline ends before it.
+- (id)valueAtIndex:(NSUInteger)index;
+
+// Returns the values from the given index until the end of the pipeline.
+- (NSArray *)valuesFromIndex:(NSUInteger)index;
+
+// Returns the values which have been produced so far from the given index
+// onwards, without evaluating the pipeline any further.
+- (NSArray *)currentValuesFromIndex:(NSUInteger)index;
+
+// Copies up to `count` values, starting from `index`, into `buffer`. Values
+// are only evaluated as far as `count`.
+//
+// The copied values are retained by the receiver for as long as it lives.
+//
+// Returns the number of values copied, which is only zero if the pipeline ends
+// before `index`.
+- (NSUInteger)getValues:(__unsafe_unretained id *)buffer fromIndex:(NSUInteger)index count:(NSUInteger)count;
+
+@end
+
+@implementation RACFusedSequenceBuffer {
+	// Protects everything below. This is held while the pipeline is evaluated.
+	pthread_mutex_t _mutex;
+
+	RACSequence *_source;
+	NSArray<RACFusedSequenceStep (^)(void)> *_stages;
+
+	// Created the first time a value is requested, and released once it's
+	// been exhausted.
+	RACFusedSequenceIterator *_iterator;
+
+	// The values produced so far. This only ever grows.
+	NSMutableArray *_values;
+
+	// Whether the pipeline has been exhausted.
+	BOOL _finished;
+}
+
+- (instancetype)initWithSource:(RACSequence *)source stages:(NSArray<RACFusedSequenceStep (^)(void)> *)stages {
+	self = [super init];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	_source = source;
+	_stages = [stages copy];
+	_values = [[NSMutableArray alloc] init];
+
+	return self;
+}
+
+- (void)dealloc {
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+// Pulls values from the pipeline until more than `index` values have been
+// produced, or the pipeline is exhausted.
+//
+// This must be invoked with _mutex held.
+- (void)evaluateThroughIndex:(NSUInteger)index {
+	if (_finished || index < _values.count) return;
+
+	if (_iterator == nil) {
+		_iterator = [[RACFusedSequenceIterator alloc] initWithSource:_source steps:RACFusedSequenceSteps(_stages)];
+		_started = YES;
+
+		// The iterator keeps what it needs.
+		_source = nil;
+		_stages = nil;
+	}
+
+	while (index >= _values.count) {
+		id value = [_iterator nextObject];
+		if (value == nil) {
+			_finished = YES;
+			_iterator = nil;
+			break;
+		}
+
+		[_values addObject:value];
+	}
+}
+
+- (id)valueAtIndex:(NSUInteger)index {
+	pthread_mutex_lock(&_mutex);
+
+	[self evaluateThroughIndex:index];
+	id value = (index < _values.count ? _values[index] : nil);
+
+	pthread_mutex_unlock(&_mutex);
+
+	return value;
+}
+
+- (NSArray *)valuesFromIndex:(NSUInteger)index {
+	pthread_mutex_lock(&_mutex);
+	[self evaluateThroughIndex:NSUIntegerMax - 1];
+	pthread_mutex_unlock(&_mutex);
+
+	return [self currentValuesFromIndex:index];
+}
+
+- (NSArray *)currentValuesFromIndex:(NSUInteger)index {
+	pthread_mutex_lock(&_mutex);
+
+	NSArray *values = @[];
+	if (index < _values.count) values = [_values subarrayWithRange:NSMakeRange(index, _values.count - index)];
+
+	pthread_mutex_unlock(&_mutex);
+
+	return values;
+}
+
+- (NSUInteger)getValues:(__unsafe_unretained id *)buffer fromIndex:(NSUInteger)index count:(NSUInteger)count {
+	NSCParameterAssert(count > 0);
+
+	pthread_mutex_lock(&_mutex);
+
+	[self evaluateThroughIndex:index + count - 1];
+
+	NSUInteger available = (index < _values.count ? MIN(count, _values.count - index) : 0);
+	[_values getObjects:buffer range:NSMakeRange(index, available)];
+
+	pthread_mutex_unlock(&_mutex);
+
+	return available;
+}
+
+@end
+
+// A pipeline over a streaming source, which is itself a streaming sequence.
+//
+// Values are pulled through the pipeline as they're consumed, and aren't
+// memoized, so enumerating it uses a constant amount of memory, just like
+// enumerating the source.
+@interface RACFusedStreamingSequence : RACStreamingSequence
+
+// The sequence which values are pulled from.
+@property (nonatomic, strong, readonly) RACStreamingSequence *source;
+
+// Blocks returning each step of the pipeline, in order.
+@property (nonatomic, copy, readonly) NSArray<RACFusedSequenceStep (^)(void)> *stages;
+
+// Whether any value has been requested from the receiver yet.
+@property (atomic, assign, readonly, getter = isStarted) BOOL started;
+
+// Returns a sequence which pulls values from `source` through a new instance
+// of the given pipeline.
++ (RACSequence *)sequenceWithSource:(RACStreamingSequence *)source stages:(NSArray<RACFusedSequenceStep (^)(void)> *)stages;
+
+@end
+
+@implementation RACFusedStreamingSequence
+
++ (RACSequence *)sequenceWithSource:(RACStreamingSequence *)source stages:(NSArray<RACFusedSequenceStep (^)(void)> *)stages {
+	// The steps are only created once the first value is requested, like
+	// those of a RACFusedSequenceBuffer.
+	__block RACFusedSequenceIterator *iterator = nil;
+
+	RACFusedStreamingSequence *sequence = (id)[self sequenceWithGenerator:^ id {
+		if (iterator == nil) iterator = [[RACFusedSequenceIterator alloc] initWithSource:source steps:RACFusedSequenceSteps(stages)];
+
+		return [iterator nextObject];
+	}];
+
+	sequence->_source = source;
+	sequence->_stages = [stages copy];
+	return sequence;
+}
+
+- (id)nextObject {
+	_started = YES;
+	return [super nextObject];
+}
+
+- (RACSequence *)memoizedSequence {
+	// Once the generator has been handed over, the pipeline may be evaluated at
+	// any time.
+	_started = YES;
+	return [super memoizedSequence];
+}
+
+@end
+
+@interface RACFusedSequence ()
+
+// The sequence which values are pulled from.
+@property (nonatomic, strong, readonly) RACSequence *source;
+
+// Blocks returning each step of the pipeline, in order.
+@property (nonatomic, copy, readonly) NSArray<RACFusedSequenceStep (^)(void)> *stages;
+
+// The values of the pipeline, shared by every node.
+@property (nonatomic, strong, readonly) RACFusedSequenceBuffer *buffer;
+
+// The index in `buffer` from which the sequence starts.
+@property (nonatomic, assign, readonly) NSUInteger index;
+
+@end
+
+@implementation RACFusedSequence
+
+#pragma mark Lifecycle
+
++ (RACSequence *)sequenceWithSequence:(RACSequence *)sequence stage:(RACFusedSequenceStep (^)(void))stage {
+	NSCParameterAssert(sequence != nil);
+	NSCParameterAssert(stage != nil);
+
+	RACSequence *source = sequence;
+	NSArray *stages = @[ [stage copy] ];
+
+	// A streaming source is only meant to be consumed once, so there's no
+	// point memoizing the pipeline's values, which would keep every one of them
+	// alive until the whole pipeline is released.
+	if ([sequence isKindOfClass:RACStreamingSequence.class]) {
+		if ([sequence isKindOfClass:RACFusedStreamingSequence.class]) {
+			RACFusedStreamingSequence *fusedSequence = (id)sequence;
+			if (!fusedSequence.started) {
+				source = fusedSequence.source;
+				stages = [fusedSequence.stages arrayByAddingObjectsFromArray:stages];
+			}
+		}
+
+		return [RACFusedStreamingSequence sequenceWithSource:(RACStreamingSequence *)source stages:stages];
+	}
+
+	// Only extend a pipeline which hasn't produced anything yet. Otherwise, its
+	// values are already memoized, and must not be evaluated a second time.
+	if ([sequence isKindOfClass:RACFusedSequence.class]) {
+		RACFusedSequence *fusedSequence = (id)sequence;
+		if (fusedSequence.index == 0 && !fusedSequence.buffer.started) {
+			source = fusedSequence.source;
+			stages = [fusedSequence.stages arrayByAddingObjectsFromArray:stages];
+		}
+	}
+
+	RACFusedSequence *fusedSequence = [[self alloc] init];
+	fusedSequence->_source = source;
+	fusedSequence->_stages = stages;
+	fusedSequence->_buffer = [[RACFusedSequenceBuffer alloc] initWithSource:source stages:stages];
+	return fusedSequence;
+}
+
++ (RACSequence *)sequenceWithBuffer:(RACFusedSequenceBuffer *)buffer index:(NSUInteger)index {
+	RACFusedSequence *fusedSequence = [[self alloc] init];
+	fusedSequence->_buffer = buffer;
+	fusedSequence->_index = index;
+	return fusedSequence;
+}
+
+#pragma mark RACSequence
+
+- (id)head {
+	return [self.buffer valueAtIndex:self.index];
+}
+
+- (RACSequence *)tail {
+	// Each node is only a cursor into the shared buffer, so advancing doesn't
+	// evaluate anything by itself.
+	RACSequence *sequence = [self.class sequenceWithBuffer:self.buffer index:self.index + 1];
+	sequence.name = self.name;
+	return sequence;
+}
+
+- (NSArray *)array {
+	return [self.buffer valuesFromIndex:self.index];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id *)stackbuf count:(NSUInteger)len {
+	if (state->state == 0) {
+		state->state = 1;
+		state->extra[0] = self.index;
+
+		// Since a sequence doesn't mutate, this just needs to be set to
+		// something non-NULL.
+		state->mutationsPtr = state->extra;
+	}
+
+	// The buffer retains every value it hands out, and the receiver retains
+	// the buffer throughout enumeration.
+	NSUInteger count = [self.buffer getValues:stackbuf fromIndex:state->extra[0] count:len];
+
+	state->itemsPtr = stackbuf;
+	state->extra[0] += count;
+
+	return count;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	// Only describe the values that have been produced so far.
+	NSArray *values = [self.buffer currentValuesFromIndex:self.index];
+
+	return [NSString stringWithFormat:@"<%@: %p>{ name = %@, values = %@ … }", self.class, self, self.name, values];
+}
+
+@end
+
+@implementation RACSequence (RACFusedSequence)
+
+- (RACSequence *)sequenceByFusingStage:(RACFusedSequenceStep (^)(void))stage {
+	return [RACFusedSequence sequenceWithSequence:self stage:stage];
+}
+
+@end
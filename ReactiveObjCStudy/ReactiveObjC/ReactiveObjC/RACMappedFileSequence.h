@@ -0,0 +1,32 @@
+//
+//  RACMappedFileSequence.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACSequence.h"
+
+// Private class that sequences the records of a memory-mapped file.
+//
+// Each record is an NSData which refers directly to the mapped file, rather
+// than a copy of it, and which keeps the mapping alive for as long as it
+// exists.
+@interface RACMappedFileSequence : RACSequence
+
+// Maps the file at the given path, and returns a sequence of the records
+// delimited by `separator`. The separators themselves are not included in the
+// records, and a trailing separator doesn't produce an empty last record.
+//
+// Returns nil and sets `error` if the file couldn't be mapped.
++ (RACSequence *)sequenceWithFileAtPath:(NSString *)path recordSeparator:(NSData *)separator error:(NSError **)error;
+
+// Maps the file at the given path, and returns a sequence of records
+// `recordLength` bytes long. The last record is shorter if the file doesn't
+// divide evenly.
+//
+// Returns nil and sets `error` if the file couldn't be mapped.
++ (RACSequence *)sequenceWithFileAtPath:(NSString *)path recordLength:(NSUInteger)recordLength error:(NSError **)error;
+
+@end
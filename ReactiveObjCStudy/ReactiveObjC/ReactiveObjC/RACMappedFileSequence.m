@@ -0,0 +1,213 @@
+//
+//  RACMappedFileSequence.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACMappedFileSequence.h"
+#import <fcntl.h>
+#import <string.h>
+#import <sys/mman.h>
+#import <sys/stat.h>
+#import <unistd.h>
+
+// Owns a read-only mapping of a whole file, which is unmapped upon
+// deallocation.
+@interface RACMappedFile : NSObject
+
+@property (nonatomic, assign, readonly) const char *bytes;
+@property (nonatomic, assign, readonly) NSUInteger length;
+
+// Returns nil and sets `error` if the file couldn't be mapped.
+- (instancetype)initWithPath:(NSString *)path error:(NSError **)error;
+
+// Returns an NSData referring to the given range of the mapping, which keeps
+// the receiver alive.
+- (NSData *)dataWithRange:(NSRange)range;
+
+@end
+
+@implementation RACMappedFile
+
+- (instancetype)initWithPath:(NSString *)path error:(NSError **)error {
+	NSCParameterAssert(path != nil);
+
+	self = [super init];
+
+	int fd = open(path.fileSystemRepresentation, O_RDONLY);
+	if (fd < 0) return [self failWithPath:path code:errno error:error];
+
+	struct stat info;
+	if (fstat(fd, &info) != 0) {
+		int code = errno;
+		close(fd);
+
+		return [self failWithPath:path code:code error:error];
+	}
+
+	_length = (NSUInteger)info.st_size;
+
+	// Mapping zero bytes is an error, but an empty file is just an empty
+	// sequence.
+	if (_length > 0) {
+		void *bytes = mmap(NULL, _length, PROT_READ, MAP_PRIVATE, fd, 0);
+		int code = errno;
+		close(fd);
+
+		if (bytes == MAP_FAILED) return [self failWithPath:path code:code error:error];
+
+		// Records are usually read from front to back, so ask for aggressive
+		// read-ahead.
+		madvise(bytes, _length, MADV_SEQUENTIAL);
+
+		_bytes = bytes;
+	} else {
+		close(fd);
+	}
+
+	return self;
+}
+
+// Sets `error` to describe the given errno value, and returns nil.
+- (id)failWithPath:(NSString *)path code:(int)code error:(NSError **)error {
+	if (error != NULL) {
+		*error = [NSError errorWithDomain:NSPOSIXErrorDomain code:code userInfo:@{ NSFilePathErrorKey: path }];
+	}
+
+	return nil;
+}
+
+- (void)dealloc {
+	if (_bytes != NULL) munmap((void *)_bytes, _length);
+}
+
+- (NSData *)dataWithRange:(NSRange)range {
+	NSCParameterAssert(NSMaxRange(range) <= self.length);
+
+	if (range.length == 0) return [NSData data];
+
+	return [[NSData alloc] initWithBytesNoCopy:(void *)(self.bytes + range.location) length:range.length deallocator:^(void *bytes, NSUInteger length) {
+		// Keeps the mapping alive for as long as the data.
+		[self class];
+	}];
+}
+
+@end
+
+@interface RACMappedFileSequence ()
+
+@property (nonatomic, strong, readonly) RACMappedFile *file;
+
+// The offset in `file` of the first record of the sequence.
+@property (nonatomic, assign, readonly) NSUInteger offset;
+
+// The bytes which delimit records, or nil if records have a fixed length.
+@property (nonatomic, copy, readonly) NSData *separator;
+
+// The length of each record, if `separator` is nil.
+@property (nonatomic, assign, readonly) NSUInteger recordLength;
+
+@end
+
+@implementation RACMappedFileSequence {
+	// The range of the first record in `file`, and the offset of the record
+	// after it, once they've been found.
+	//
+	// These ivars should only be accessed while synchronized on self.
+	NSRange _recordRange;
+	NSUInteger _nextOffset;
+	BOOL _hasFoundRecord;
+}
+
+#pragma mark Lifecycle
+
++ (RACSequence *)sequenceWithFileAtPath:(NSString *)path recordSeparator:(NSData *)separator error:(NSError **)error {
+	NSCParameterAssert(separator.length > 0);
+
+	RACMappedFile *file = [[RACMappedFile alloc] initWithPath:path error:error];
+	if (file == nil) return nil;
+
+	return [[self sequenceWithFile:file offset:0 separator:separator recordLength:0] setNameWithFormat:@"+sequenceWithMappedFileAtPath: %@ recordSeparator: %@", path, separator];
+}
+
++ (RACSequence *)sequenceWithFileAtPath:(NSString *)path recordLength:(NSUInteger)recordLength error:(NSError **)error {
+	NSCParameterAssert(recordLength > 0);
+
+	RACMappedFile *file = [[RACMappedFile alloc] initWithPath:path error:error];
+	if (file == nil) return nil;
+
+	return [[self sequenceWithFile:file offset:0 separator:nil recordLength:recordLength] setNameWithFormat:@"+sequenceWithMappedFileAtPath: %@ recordLength: %lu", path, (unsigned long)recordLength];
+}
+
++ (RACSequence *)sequenceWithFile:(RACMappedFile *)file offset:(NSUInteger)offset separator:(NSData *)separator recordLength:(NSUInteger)recordLength {
+	if (offset >= file.length) return self.empty;
+
+	RACMappedFileSequence *seq = [[self alloc] init];
+	seq->_file = file;
+	seq->_offset = offset;
+	seq->_separator = [separator copy];
+	seq->_recordLength = recordLength;
+	return seq;
+}
+
+#pragma mark Records
+
+// Finds the first record of the sequence, if it hasn't been found already.
+//
+// This must be invoked while synchronized on self.
+- (void)findRecord {
+	if (_hasFoundRecord) return;
+
+	NSUInteger length = self.file.length;
+	NSUInteger offset = self.offset;
+
+	if (self.separator == nil) {
+		_recordRange = NSMakeRange(offset, MIN(self.recordLength, length - offset));
+		_nextOffset = NSMaxRange(_recordRange);
+	} else {
+		const char *start = self.file.bytes + offset;
+		const char *match = memmem(start, length - offset, self.separator.bytes, self.separator.length);
+
+		if (match == NULL) {
+			_recordRange = NSMakeRange(offset, length - offset);
+			_nextOffset = length;
+		} else {
+			_recordRange = NSMakeRange(offset, (NSUInteger)(match - start));
+			_nextOffset = NSMaxRange(_recordRange) + self.separator.length;
+		}
+	}
+
+	_hasFoundRecord = YES;
+}
+
+#pragma mark RACSequence
+
+- (id)head {
+	@synchronized (self) {
+		[self findRecord];
+		return [self.file dataWithRange:_recordRange];
+	}
+}
+
+- (RACSequence *)tail {
+	NSUInteger nextOffset;
+
+	@synchronized (self) {
+		[self findRecord];
+		nextOffset = _nextOffset;
+	}
+
+	RACSequence *sequence = [self.class sequenceWithFile:self.file offset:nextOffset separator:self.separator recordLength:self.recordLength];
+	sequence.name = self.name;
+	return sequence;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p>{ name = %@, offset = %lu, length = %lu }", self.class, self, self.name, (unsigned long)self.offset, (unsigned long)self.file.length];
+}
+
+@end
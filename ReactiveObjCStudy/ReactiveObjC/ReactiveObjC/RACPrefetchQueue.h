@@ -0,0 +1,35 @@
+//
+//  RACPrefetchQueue.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RACScheduler;
+@class RACSequence;
+
+// Private class that evaluates the values of a sequence ahead of time on a
+// scheduler, into a bounded buffer.
+//
+// Evaluation pauses whenever the buffer is full, without blocking the
+// scheduler, and resumes once half of the buffer has been taken.
+@interface RACPrefetchQueue : NSObject
+
+// Immediately begins evaluating `sequence` on `scheduler`.
+//
+// sequence  - The sequence to evaluate. Cannot be nil.
+// capacity  - The maximum number of values to evaluate before they've been
+//             taken. Must be greater than zero.
+// scheduler - The scheduler on which to evaluate the sequence. Cannot be nil.
+- (instancetype)initWithSequence:(RACSequence *)sequence capacity:(NSUInteger)capacity scheduler:(RACScheduler *)scheduler;
+
+// Blocks until the next value of the sequence has been evaluated, then removes
+// it from the buffer.
+//
+// Returns the next value, or nil if the sequence has been exhausted.
+- (id)takeValue;
+
+@end
@@ -0,0 +1,143 @@
+//
+//  RACPrefetchQueue.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACPrefetchQueue.h"
+#import "RACScheduler.h"
+#import "RACSequence.h"
+#import <pthread.h>
+
+@interface RACPrefetchQueue ()
+
+@property (nonatomic, assign, readonly) NSUInteger capacity;
+@property (nonatomic, strong, readonly) RACScheduler *scheduler;
+
+@end
+
+@implementation RACPrefetchQueue {
+	// Protects everything below, except _rest.
+	pthread_mutex_t _mutex;
+
+	// Broadcast whenever a value is added to _values, or the sequence is
+	// exhausted.
+	pthread_cond_t _condition;
+
+	// Values which have been evaluated but not yet taken, in order.
+	NSMutableArray *_values;
+
+	// Whether every value of the sequence has been added to _values.
+	BOOL _exhausted;
+
+	// Whether evaluation is scheduled or running.
+	BOOL _producing;
+
+	// The part of the sequence which has yet to be evaluated. This is only
+	// used by -produce, which never runs concurrently with itself.
+	RACSequence *_rest;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithSequence:(RACSequence *)sequence capacity:(NSUInteger)capacity scheduler:(RACScheduler *)scheduler {
+	NSCParameterAssert(sequence != nil);
+	NSCParameterAssert(capacity > 0);
+	NSCParameterAssert(scheduler != nil);
+
+	self = [super init];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	pthread_cond_init(&_condition, NULL);
+
+	_rest = sequence;
+	_capacity = capacity;
+	_scheduler = scheduler;
+	_values = [[NSMutableArray alloc] initWithCapacity:capacity];
+
+	_producing = YES;
+	[self scheduleProduction];
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_cond_destroy(&_condition);
+
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+#pragma mark Production
+
+- (void)scheduleProduction {
+	[self.scheduler schedule:^{
+		[self produce];
+	}];
+}
+
+// Evaluates values until the buffer is full or the sequence is exhausted.
+- (void)produce {
+	while (YES) {
+		pthread_mutex_lock(&_mutex);
+
+		if (_values.count >= self.capacity) {
+			// Pause until a value is taken.
+			_producing = NO;
+			pthread_mutex_unlock(&_mutex);
+			return;
+		}
+
+		pthread_mutex_unlock(&_mutex);
+
+		id value;
+		@autoreleasepool {
+			value = _rest.head;
+			_rest = (value != nil ? _rest.tail : nil);
+		}
+
+		pthread_mutex_lock(&_mutex);
+
+		if (value == nil) {
+			_exhausted = YES;
+			_producing = NO;
+		} else {
+			[_values addObject:value];
+		}
+
+		pthread_cond_broadcast(&_condition);
+		pthread_mutex_unlock(&_mutex);
+
+		if (value == nil) return;
+	}
+}
+
+#pragma mark Consumption
+
+- (id)takeValue {
+	pthread_mutex_lock(&_mutex);
+
+	while (_values.count == 0 && !_exhausted) {
+		pthread_cond_wait(&_condition, &_mutex);
+	}
+
+	id value = _values.firstObject;
+	if (value != nil) [_values removeObjectAtIndex:0];
+
+	// Resume evaluation once the buffer has drained halfway, so that a
+	// consumer which keeps up doesn't reschedule it for every value.
+	BOOL resume = (!_producing && !_exhausted && _values.count <= self.capacity / 2);
+	if (resume) _producing = YES;
+
+	pthread_mutex_unlock(&_mutex);
+
+	if (resume) [self scheduleProduction];
+
+	return value;
+}
+
+@end
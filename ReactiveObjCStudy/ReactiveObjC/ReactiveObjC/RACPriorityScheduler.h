@@ -0,0 +1,58 @@
+//
+//  RACPriorityScheduler.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACScheduler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// A scheduler representing one priority lane of a shared serial executor.
+//
+// All lanes created from the same executor run their blocks one at a time, in
+// the same serial context. Whenever the executor is ready to run another block,
+// it picks from the highest priority lane which has work pending, so blocks on
+// a high priority lane are never stuck behind a backlog on a lower one.
+//
+// Within a lane, blocks normally run in the order in which they became ready.
+// If the executor uses earliest-deadline-first ordering, each block is instead
+// given a deadline: the time at which it was scheduled for -schedule:, or the
+// requested date for -after:schedule: and repeating blocks. The block with the
+// earliest deadline in the lane runs first, so a timer which is late is not
+// also queued behind work that was scheduled after it was due.
+@interface RACPriorityScheduler : RACScheduler
+
+// The number of lanes in the receiver's executor.
+@property (nonatomic, assign, readonly) NSUInteger laneCount;
+
+// The lane which the receiver schedules blocks on. Lane 0 has the highest
+// priority.
+@property (nonatomic, assign, readonly) NSUInteger lane;
+
+// Whether blocks within each lane are ordered by deadline, rather than by the
+// order in which they became ready.
+@property (nonatomic, assign, readonly) BOOL earliestDeadlineFirst;
+
+// Initializes the receiver with a new executor, as the scheduler for lane 0.
+//
+// name                  - The name of the scheduler. If nil, a default name
+//                         will be used.
+// laneCount             - The number of priority lanes. Must be greater than
+//                         zero.
+// earliestDeadlineFirst - Whether to order the blocks within each lane by
+//                         deadline.
+//
+// Returns the initialized object.
+- (instancetype)initWithName:(nullable NSString *)name laneCount:(NSUInteger)laneCount earliestDeadlineFirst:(BOOL)earliestDeadlineFirst;
+
+// Returns the scheduler for the given lane of the receiver's executor.
+//
+// lane - The lane to return a scheduler for. Must be less than `laneCount`.
+- (RACPriorityScheduler *)schedulerForLane:(NSUInteger)lane;
+
+@end
+
+NS_ASSUME_NONNULL_END
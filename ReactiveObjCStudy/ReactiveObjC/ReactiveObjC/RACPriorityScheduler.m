@@ -0,0 +1,327 @@
+//
+//  RACPriorityScheduler.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACPriorityScheduler.h"
+#import "RACDisposable.h"
+#import "RACQueueScheduler+Subclass.h"
+#import "RACScheduler+Private.h"
+#import <pthread.h>
+
+@interface RACPrioritySchedulerAction : NSObject {
+@public
+	// The lane scheduler which the action was scheduled on.
+	RACPriorityScheduler *_scheduler;
+
+	// The deadline of the action, as an absolute time. Only used for ordering.
+	CFAbsoluteTime _deadline;
+
+	// The order in which the action became ready, used to break ties.
+	uint64_t _sequenceNumber;
+
+	void (^_block)(void);
+	RACDisposable *_disposable;
+}
+
+@end
+
+@implementation RACPrioritySchedulerAction
+@end
+
+static CFComparisonResult RACCompareActionsBySequence(const void *ptr1, const void *ptr2, void *info) {
+	RACPrioritySchedulerAction *action1 = (__bridge id)ptr1;
+	RACPrioritySchedulerAction *action2 = (__bridge id)ptr2;
+
+	if (action1->_sequenceNumber < action2->_sequenceNumber) return kCFCompareLessThan;
+	if (action1->_sequenceNumber > action2->_sequenceNumber) return kCFCompareGreaterThan;
+	return kCFCompareEqualTo;
+}
+
+static CFComparisonResult RACCompareActionsByDeadline(const void *ptr1, const void *ptr2, void *info) {
+	RACPrioritySchedulerAction *action1 = (__bridge id)ptr1;
+	RACPrioritySchedulerAction *action2 = (__bridge id)ptr2;
+
+	if (action1->_deadline < action2->_deadline) return kCFCompareLessThan;
+	if (action1->_deadline > action2->_deadline) return kCFCompareGreaterThan;
+	return RACCompareActionsBySequence(ptr1, ptr2, info);
+}
+
+static const void *RACRetainPriorityAction(CFAllocatorRef allocator, const void *ptr) {
+	return CFRetain(ptr);
+}
+
+static void RACReleasePriorityAction(CFAllocatorRef allocator, const void *ptr) {
+	CFRelease(ptr);
+}
+
+// The serial context shared by all the lanes of a RACPriorityScheduler.
+@interface RACPrioritySchedulerExecutor : NSObject
+
+@property (nonatomic, assign, readonly) NSUInteger laneCount;
+@property (nonatomic, assign, readonly) BOOL earliestDeadlineFirst;
+
+// The serial queue on which all blocks are executed.
+@property (nonatomic, strong, readonly) dispatch_queue_t queue;
+
+- (instancetype)initWithName:(NSString *)name laneCount:(NSUInteger)laneCount earliestDeadlineFirst:(BOOL)earliestDeadlineFirst;
+
+// Returns the scheduler for the given lane, creating it if necessary.
+- (RACPriorityScheduler *)schedulerForLane:(NSUInteger)lane;
+
+// Records the scheduler for its lane, so that -schedulerForLane: returns it.
+- (void)registerScheduler:(RACPriorityScheduler *)scheduler;
+
+// Makes the given action ready to run on its lane.
+- (void)enqueueAction:(RACPrioritySchedulerAction *)action;
+
+@end
+
+@interface RACPriorityScheduler ()
+
+@property (nonatomic, strong, readonly) RACPrioritySchedulerExecutor *executor;
+
+- (instancetype)initWithName:(NSString *)name executor:(RACPrioritySchedulerExecutor *)executor lane:(NSUInteger)lane;
+
+@end
+
+@implementation RACPrioritySchedulerExecutor {
+	// Protects everything below.
+	pthread_mutex_t _mutex;
+
+	// One heap of ready RACPrioritySchedulerActions per lane. The minimum value
+	// in each heap is the action to run next from that lane.
+	CFBinaryHeapRef *_lanes;
+
+	uint64_t _nextSequenceNumber;
+
+	// The scheduler for each lane, held weakly since they retain the executor.
+	NSPointerArray *_schedulers;
+
+	NSString *_name;
+}
+
+- (instancetype)initWithName:(NSString *)name laneCount:(NSUInteger)laneCount earliestDeadlineFirst:(BOOL)earliestDeadlineFirst {
+	NSCParameterAssert(name != nil);
+	NSCParameterAssert(laneCount > 0);
+
+	self = [super init];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	_name = [name copy];
+	_laneCount = laneCount;
+	_earliestDeadlineFirst = earliestDeadlineFirst;
+	_queue = dispatch_queue_create(name.UTF8String, DISPATCH_QUEUE_SERIAL);
+
+	_schedulers = [NSPointerArray weakObjectsPointerArray];
+	_schedulers.count = laneCount;
+
+	CFBinaryHeapCallBacks callbacks = (CFBinaryHeapCallBacks){
+		.version = 0,
+		.retain = &RACRetainPriorityAction,
+		.release = &RACReleasePriorityAction,
+		.copyDescription = &CFCopyDescription,
+		.compare = (earliestDeadlineFirst ? &RACCompareActionsByDeadline : &RACCompareActionsBySequence)
+	};
+
+	_lanes = calloc(laneCount, sizeof(*_lanes));
+	for (NSUInteger i = 0; i < laneCount; i++) {
+		_lanes[i] = CFBinaryHeapCreate(NULL, 0, &callbacks, NULL);
+	}
+
+	return self;
+}
+
+- (void)dealloc {
+	for (NSUInteger i = 0; i < _laneCount; i++) {
+		CFRelease(_lanes[i]);
+	}
+
+	free(_lanes);
+
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+- (RACPriorityScheduler *)schedulerForLane:(NSUInteger)lane {
+	NSCParameterAssert(lane < _laneCount);
+
+	pthread_mutex_lock(&_mutex);
+
+	RACPriorityScheduler *scheduler = [_schedulers pointerAtIndex:lane];
+	if (scheduler == nil) {
+		NSString *name = [NSString stringWithFormat:@"%@.lane-%lu", _name, (unsigned long)lane];
+		scheduler = [[RACPriorityScheduler alloc] initWithName:name executor:self lane:lane];
+		[_schedulers replacePointerAtIndex:lane withPointer:(__bridge void *)scheduler];
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	return scheduler;
+}
+
+- (void)registerScheduler:(RACPriorityScheduler *)scheduler {
+	pthread_mutex_lock(&_mutex);
+	[_schedulers replacePointerAtIndex:scheduler.lane withPointer:(__bridge void *)scheduler];
+	pthread_mutex_unlock(&_mutex);
+}
+
+- (void)enqueueAction:(RACPrioritySchedulerAction *)action {
+	pthread_mutex_lock(&_mutex);
+	action->_sequenceNumber = _nextSequenceNumber++;
+	CFBinaryHeapAddValue(_lanes[action->_scheduler.lane], (__bridge void *)action);
+	pthread_mutex_unlock(&_mutex);
+
+	// Each enqueued action adds one turn on the queue, but that turn runs
+	// whichever action has the highest priority when it begins.
+	dispatch_async(self.queue, ^{
+		[self performNextAction];
+	});
+}
+
+- (void)performNextAction {
+	RACPrioritySchedulerAction *action = nil;
+
+	pthread_mutex_lock(&_mutex);
+
+	for (NSUInteger i = 0; i < _laneCount; i++) {
+		const void *actionPtr = NULL;
+		if (!CFBinaryHeapGetMinimumIfPresent(_lanes[i], &actionPtr)) continue;
+
+		action = (__bridge id)actionPtr;
+		CFBinaryHeapRemoveMinimumValue(_lanes[i]);
+		break;
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	if (action == nil || action->_disposable.disposed) return;
+	[action->_scheduler performAsCurrentScheduler:action->_block];
+}
+
+@end
+
+@implementation RACPriorityScheduler
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithName:(NSString *)name laneCount:(NSUInteger)laneCount earliestDeadlineFirst:(BOOL)earliestDeadlineFirst {
+	NSCParameterAssert(laneCount > 0);
+
+	if (name == nil) name = @"org.reactivecocoa.ReactiveObjC.RACPriorityScheduler";
+
+	RACPrioritySchedulerExecutor *executor = [[RACPrioritySchedulerExecutor alloc] initWithName:name laneCount:laneCount earliestDeadlineFirst:earliestDeadlineFirst];
+
+	self = [self initWithName:name executor:executor lane:0];
+	[executor registerScheduler:self];
+
+	return self;
+}
+
+- (instancetype)initWithName:(NSString *)name executor:(RACPrioritySchedulerExecutor *)executor lane:(NSUInteger)lane {
+	NSCParameterAssert(executor != nil);
+	NSCParameterAssert(lane < executor.laneCount);
+
+	self = [super initWithName:name];
+
+	_executor = executor;
+	_lane = lane;
+
+	return self;
+}
+
+- (RACPriorityScheduler *)schedulerForLane:(NSUInteger)lane {
+	NSCParameterAssert(lane < self.laneCount);
+
+	return [self.executor schedulerForLane:lane];
+}
+
+#pragma mark Properties
+
+- (NSUInteger)laneCount {
+	return self.executor.laneCount;
+}
+
+- (BOOL)earliestDeadlineFirst {
+	return self.executor.earliestDeadlineFirst;
+}
+
+#pragma mark Actions
+
+- (RACPrioritySchedulerAction *)actionWithDeadline:(CFAbsoluteTime)deadline block:(void (^)(void))block disposable:(RACDisposable *)disposable {
+	RACPrioritySchedulerAction *action = [[RACPrioritySchedulerAction alloc] init];
+	action->_scheduler = self;
+	action->_deadline = deadline;
+	action->_block = [block copy];
+	action->_disposable = disposable;
+
+	return action;
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	NSCParameterAssert(block != NULL);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+	[self.executor enqueueAction:[self actionWithDeadline:CFAbsoluteTimeGetCurrent() block:block disposable:disposable]];
+
+	return disposable;
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != NULL);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+	RACPrioritySchedulerAction *action = [self actionWithDeadline:date.timeIntervalSinceReferenceDate block:block disposable:disposable];
+
+	dispatch_after([RACQueueScheduler wallTimeWithDate:date], self.executor.queue, ^{
+		if (disposable.disposed) return;
+		[self.executor enqueueAction:action];
+	});
+
+	return disposable;
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(interval > 0.0 && interval < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(leeway >= 0.0 && leeway < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(block != NULL);
+
+	uint64_t intervalInNanoSecs = (uint64_t)(interval * NSEC_PER_SEC);
+	uint64_t leewayInNanoSecs = (uint64_t)(leeway * NSEC_PER_SEC);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+	block = [block copy];
+
+	// The deadline of each tick is the time at which it was due, rather than
+	// the time at which the timer actually fired.
+	__block CFAbsoluteTime deadline = date.timeIntervalSinceReferenceDate;
+
+	dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.executor.queue);
+	dispatch_source_set_timer(timer, [RACQueueScheduler wallTimeWithDate:date], intervalInNanoSecs, leewayInNanoSecs);
+	dispatch_source_set_event_handler(timer, ^{
+		// If the handler fell behind, several fires are coalesced into one call,
+		// so skip ahead to the most recent of them.
+		unsigned long fireCount = MAX(dispatch_source_get_data(timer), 1UL);
+		deadline += interval * (fireCount - 1);
+
+		[self.executor enqueueAction:[self actionWithDeadline:fmin(deadline, CFAbsoluteTimeGetCurrent()) block:block disposable:disposable]];
+		deadline += interval;
+	});
+	dispatch_resume(timer);
+
+	return [RACDisposable disposableWithBlock:^{
+		[disposable dispose];
+		dispatch_source_cancel(timer);
+	}];
+}
+
+@end
@@ -84,6 +84,20 @@
 	return disposable;
 }
 
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	NSCParameterAssert(delay < INT64_MAX);
+	NSCParameterAssert(block != NULL);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+
+	dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)delay), self.queue, ^{
+		if (disposable.disposed) return;
+		[self performAsCurrentScheduler:block];
+	});
+
+	return disposable;
+}
+
 - (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
 	NSCParameterAssert(date != nil);
 	NSCParameterAssert(interval > 0.0 && interval < INT64_MAX / NSEC_PER_SEC);
@@ -103,4 +117,19 @@
 	}];
 }
 
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(delay < INT64_MAX);
+	NSCParameterAssert(interval > 0);
+	NSCParameterAssert(block != NULL);
+
+	dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, self.queue);
+	dispatch_source_set_timer(timer, dispatch_time(DISPATCH_TIME_NOW, (int64_t)delay), interval, leeway);
+	dispatch_source_set_event_handler(timer, block);
+	dispatch_resume(timer);
+
+	return [RACDisposable disposableWithBlock:^{
+		dispatch_source_cancel(timer);
+	}];
+}
+
 @end
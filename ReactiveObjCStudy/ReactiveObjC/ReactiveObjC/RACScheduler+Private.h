@@ -13,6 +13,10 @@ NS_ASSUME_NONNULL_BEGIN
 // The thread-specific current scheduler key.
 extern NSString * const RACSchedulerCurrentSchedulerKey;
 
+// Adds a block to the end of a scheduler's own queue, to be executed as soon as
+// the scheduler gets to it.
+typedef void (^RACSchedulerEnqueueBlock)(void (^block)(void));
+
 // A private interface for internal RAC use only.
 @interface RACScheduler ()
 
@@ -40,6 +44,20 @@ extern NSString * const RACSchedulerCurrentSchedulerKey;
 // Returns the initialized object.
 - (instancetype)initWithName:(nullable NSString *)name;
 
+// Implements the RACScheduler methods for schedulers which keep their own queue
+// of blocks, rather than executing them on a GCD queue.
+//
+// Each scheduled block is wrapped so that it does nothing once the returned
+// disposable has been disposed, and then passed to `enqueue`. Blocks scheduled
+// for later are held by a timer on `timerQueue` until they are due.
+//
+// timerQueue - A serial queue on which to run timers. Cannot be NULL.
+// enqueue    - Adds a block to the receiver's queue. When invoked by a timer,
+//              this is invoked on `timerQueue`. Cannot be nil.
+- (RACDisposable *)schedule:(void (^)(void))block enqueue:(RACSchedulerEnqueueBlock)enqueue;
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block timerQueue:(dispatch_queue_t)timerQueue enqueue:(RACSchedulerEnqueueBlock)enqueue;
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block timerQueue:(dispatch_queue_t)timerQueue enqueue:(RACSchedulerEnqueueBlock)enqueue;
+
 @end
 
 NS_ASSUME_NONNULL_END
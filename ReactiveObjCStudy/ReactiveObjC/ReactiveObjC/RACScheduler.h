@@ -29,6 +29,12 @@ typedef void (^RACSchedulerRecursiveBlock)(void (^reschedule)(void));
 
 @class RACDisposable;
 
+// Returns the current time of a monotonic clock, in nanoseconds.
+//
+// The clock is unaffected by changes to the system wall clock, so it is
+// suitable for measuring intervals. Its starting point is arbitrary.
+extern uint64_t RACMonotonicTime(void);
+
 /*
  Schedulers are used to control when and where work is performed.
 
@@ -41,8 +47,24 @@ typedef void (^RACSchedulerRecursiveBlock)(void (^reschedule)(void));
 // **Note:** Unlike most other schedulers, this does not set the current
 // scheduler. There may still be a valid +currentScheduler if this is used
 // within a block scheduled on a different scheduler.
+//
+// Blocks scheduled from within a block on this scheduler are executed
+// recursively, so use +trampolineScheduler for deeply nested work. Signal
+// subscriptions are trampolined once they nest deeply, whichever scheduler
+// they're made on, and -scheduleRecursiveBlock: reschedules iteratively.
 + (RACScheduler *)immediateScheduler;
 
+// A singleton scheduler that executes the blocks it is given synchronously on
+// the calling thread, like +immediateScheduler, but without recursing.
+//
+// Blocks scheduled from within another block on this scheduler are queued, and
+// executed in order once the outer block returns. This keeps the stack depth
+// constant for long synchronous chains, while still guaranteeing that all the
+// work has finished by the time the outermost call to -schedule: returns.
+//
+// **Note:** Like +immediateScheduler, this does not set the current scheduler.
++ (RACScheduler *)trampolineScheduler;
+
 // A singleton scheduler that executes blocks in the main thread.
 + (RACScheduler *)mainThreadScheduler;
 
@@ -97,6 +119,47 @@ typedef void (^RACSchedulerRecursiveBlock)(void (^reschedule)(void));
 // Converts the delay into an NSDate, then invokes `-after:schedule:`.
 - (nullable RACDisposable *)afterDelay:(NSTimeInterval)delay schedule:(void (^)(void))block;
 
+// Schedule the given block for execution on the scheduler after a delay,
+// measured with a monotonic clock.
+//
+// Unlike -after:schedule:, the delay is unaffected by changes to the system
+// wall clock, and no NSDate needs to be created. The monotonic clock does not
+// advance while the system is asleep, however.
+//
+// The default implementation converts the delay into an NSDate, then invokes
+// `-after:schedule:`. Schedulers backed by GCD queues wait on the monotonic
+// clock directly.
+//
+// delay - The number of nanoseconds to wait before `block` may begin
+//         executing.
+// block - The block to schedule for execution. Cannot be nil.
+//
+// Returns a disposable which can be used to cancel the scheduled block before
+// it begins executing, or nil if cancellation is not supported.
+- (nullable RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block;
+
+// Reschedule the given block at a particular interval, measured with
+// a monotonic clock.
+//
+// This behaves like -after:repeatingEvery:withLeeway:schedule:, except that all
+// times are given in nanoseconds relative to now. The default implementation
+// converts them and invokes that method. Schedulers backed by GCD queues use
+// the monotonic clock directly.
+//
+// It is considered undefined behavior to invoke this method on the
+// +immediateScheduler.
+//
+// delay    - The number of nanoseconds to wait before `block` first executes.
+// interval - The number of nanoseconds between each execution of `block`. Must
+//            be greater than zero.
+// leeway   - A hint to the system indicating the number of nanoseconds that
+//            each scheduling can be deferred.
+// block    - The block to repeatedly schedule for execution. Cannot be nil.
+//
+// Returns a disposable which can be used to cancel the automatic scheduling and
+// rescheduling, or nil if cancellation is not supported.
+- (nullable RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block;
+
 // Reschedule the given block at a particular interval, starting at a specific
 // time, and with a given leeway for deferral.
 //
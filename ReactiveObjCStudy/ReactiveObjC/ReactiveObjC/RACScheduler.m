@@ -7,20 +7,221 @@
 //
 
 #import "RACScheduler.h"
-#import "RACCompoundDisposable.h"
 #import "RACDisposable.h"
 #import "RACImmediateScheduler.h"
+#import "RACQueueScheduler+Subclass.h"
 #import "RACScheduler+Private.h"
+#import "RACSerialDisposable.h"
 #import "RACSubscriptionScheduler.h"
 #import "RACTargetQueueScheduler.h"
+#import "RACTrampolineScheduler.h"
+#import <mach/mach_time.h>
+#import <pthread.h>
 
 // The key for the thread-specific current scheduler.
 NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedulerKey";
 
+uint64_t RACMonotonicTime(void) {
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		mach_timebase_info(&timebase);
+	});
+
+	return mach_absolute_time() * timebase.numer / timebase.denom;
+}
+
 @interface RACScheduler ()
 @property (nonatomic, readonly, copy) NSString *name;
 @end
 
+// The state shared by every iteration of a single -scheduleRecursiveBlock:
+// call, so that each iteration only costs one -schedule:.
+@interface RACRecursiveScheduling : NSObject
+
+- (instancetype)initWithScheduler:(RACScheduler *)scheduler recursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock;
+
+// Schedules one more invocation of the recursive block.
+//
+// Only one iteration is ever scheduled at a time. If the recursive block is
+// currently executing, or an iteration is already scheduled, the invocation is
+// scheduled once that one returns, flattening synchronous recursion into
+// iteration.
+- (void)scheduleIteration;
+
+// Stops any further iterations and releases the recursive block.
+- (void)dispose;
+
+@end
+
+@implementation RACRecursiveScheduling {
+	// Protects all of the variables below.
+	pthread_mutex_t _mutex;
+
+	RACScheduler *_scheduler;
+	RACSchedulerRecursiveBlock _recursiveBlock;
+
+	// Blocks which retain the receiver. They are created lazily, and released
+	// whenever no iteration is scheduled or executing, so that the receiver
+	// isn't kept alive by a cycle once the recursion has stopped.
+	void (^_iterationBlock)(void);
+	void (^_rescheduleBlock)(void);
+
+	// Whether an iteration has been scheduled but not yet begun.
+	BOOL _pending;
+
+	// The number of iterations which have been scheduled since the receiver
+	// was created, so that a disposable can be matched to its iteration.
+	NSUInteger _iterationCount;
+
+	// Cancels the pending iteration, if any. Each iteration clears this once it
+	// begins, and it's disposed along with the receiver.
+	RACSerialDisposable *_pendingDisposable;
+
+	// Whether the recursive block is currently executing.
+	BOOL _executing;
+
+	// The number of times the recursive block asked to be rescheduled while
+	// `_executing`, or while another iteration was `_pending`.
+	NSUInteger _deferredCount;
+
+	BOOL _disposed;
+}
+
+- (instancetype)initWithScheduler:(RACScheduler *)scheduler recursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock {
+	NSCParameterAssert(scheduler != nil);
+	NSCParameterAssert(recursiveBlock != NULL);
+
+	self = [super init];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	_scheduler = scheduler;
+	_recursiveBlock = [recursiveBlock copy];
+	_pendingDisposable = [[RACSerialDisposable alloc] init];
+
+	return self;
+}
+
+- (void)dealloc {
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+- (void)scheduleIteration {
+	pthread_mutex_lock(&_mutex);
+
+	if (_disposed) {
+		pthread_mutex_unlock(&_mutex);
+		return;
+	}
+
+	if (_executing || _pending) {
+		_deferredCount++;
+		pthread_mutex_unlock(&_mutex);
+		return;
+	}
+
+	if (_iterationBlock == nil) {
+		_iterationBlock = ^{
+			[self performIteration];
+		};
+	}
+
+	void (^iterationBlock)(void) = _iterationBlock;
+	NSUInteger iteration = ++_iterationCount;
+	_pending = YES;
+
+	pthread_mutex_unlock(&_mutex);
+
+	RACDisposable *disposable = [_scheduler schedule:iterationBlock];
+	if (disposable == nil) return;
+
+	pthread_mutex_lock(&_mutex);
+
+	// If this iteration has begun already, there's nothing left to cancel, and
+	// the slot may even belong to a later iteration by now. If the receiver has
+	// been disposed, this disposes of the iteration straight away.
+	if (_pending && _iterationCount == iteration) _pendingDisposable.disposable = disposable;
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+- (void)performIteration {
+	pthread_mutex_lock(&_mutex);
+
+	_pending = NO;
+	_pendingDisposable.disposable = nil;
+
+	if (_disposed) {
+		pthread_mutex_unlock(&_mutex);
+		return;
+	}
+
+	if (_rescheduleBlock == nil) {
+		_rescheduleBlock = ^{
+			[self scheduleIteration];
+		};
+	}
+
+	RACSchedulerRecursiveBlock recursiveBlock = _recursiveBlock;
+	void (^rescheduleBlock)(void) = _rescheduleBlock;
+	_executing = YES;
+
+	pthread_mutex_unlock(&_mutex);
+
+	@autoreleasepool {
+		recursiveBlock(rescheduleBlock);
+	}
+
+	// Moved out of the ivars while idle, and released after unlocking.
+	void (^idleIterationBlock)(void) __attribute__((unused)) = nil;
+	void (^idleRescheduleBlock)(void) __attribute__((unused)) = nil;
+
+	pthread_mutex_lock(&_mutex);
+
+	_executing = NO;
+
+	// Schedule one of the deferred iterations, which will schedule the next
+	// once it has run.
+	BOOL reschedule = (_deferredCount > 0);
+	if (reschedule) _deferredCount--;
+
+	if (!reschedule && !_pending) {
+		idleIterationBlock = _iterationBlock;
+		idleRescheduleBlock = _rescheduleBlock;
+		_iterationBlock = nil;
+		_rescheduleBlock = nil;
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	if (reschedule) [self scheduleIteration];
+}
+
+- (void)dispose {
+	pthread_mutex_lock(&_mutex);
+
+	_disposed = YES;
+
+	// Released after unlocking, since they may retain arbitrary objects.
+	RACSchedulerRecursiveBlock recursiveBlock __attribute__((unused)) = _recursiveBlock;
+	void (^iterationBlock)(void) __attribute__((unused)) = _iterationBlock;
+	void (^rescheduleBlock)(void) __attribute__((unused)) = _rescheduleBlock;
+	_recursiveBlock = nil;
+	_iterationBlock = nil;
+	_rescheduleBlock = nil;
+
+	pthread_mutex_unlock(&_mutex);
+
+	// Cancel the iteration which is still queued, if any, so that it doesn't
+	// linger on the scheduler.
+	[_pendingDisposable dispose];
+}
+
+@end
+
 @implementation RACScheduler
 
 #pragma mark NSObject
@@ -55,6 +256,16 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 	return immediateScheduler;
 }
 
++ (RACScheduler *)trampolineScheduler {
+	static dispatch_once_t onceToken;
+	static RACScheduler *trampolineScheduler;
+	dispatch_once(&onceToken, ^{
+		trampolineScheduler = [[RACTrampolineScheduler alloc] init];
+	});
+
+	return trampolineScheduler;
+}
+
 + (RACScheduler *)mainThreadScheduler {
 	static dispatch_once_t onceToken;
 	static RACScheduler *mainThreadScheduler;
@@ -112,7 +323,16 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 }
 
 - (RACDisposable *)afterDelay:(NSTimeInterval)delay schedule:(void (^)(void))block {
-	return [self after:[NSDate dateWithTimeIntervalSinceNow:delay] schedule:block];
+	return [self afterNanoseconds:(uint64_t)(fmax(delay, 0) * NSEC_PER_SEC) schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	return [self after:[NSDate dateWithTimeIntervalSinceNow:(NSTimeInterval)delay / NSEC_PER_SEC] schedule:block];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSDate *date = [NSDate dateWithTimeIntervalSinceNow:(NSTimeInterval)delay / NSEC_PER_SEC];
+	return [self after:date repeatingEvery:(NSTimeInterval)interval / NSEC_PER_SEC withLeeway:(NSTimeInterval)leeway / NSEC_PER_SEC schedule:block];
 }
 
 - (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
@@ -121,69 +341,78 @@ NSString * const RACSchedulerCurrentSchedulerKey = @"RACSchedulerCurrentSchedule
 }
 
 - (RACDisposable *)scheduleRecursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock {
-	RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
+	RACRecursiveScheduling *recursiveScheduling = [[RACRecursiveScheduling alloc] initWithScheduler:self recursiveBlock:recursiveBlock];
+	[recursiveScheduling scheduleIteration];
+
+	return [RACDisposable disposableWithBlock:^{
+		[recursiveScheduling dispose];
+	}];
+}
+
+#pragma mark Enqueuing
+
+- (RACDisposable *)schedule:(void (^)(void))block enqueue:(RACSchedulerEnqueueBlock)enqueue {
+	NSCParameterAssert(block != NULL);
+	NSCParameterAssert(enqueue != nil);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+
+	enqueue(^{
+		if (disposable.disposed) return;
+		block();
+	});
 
-	[self scheduleRecursiveBlock:[recursiveBlock copy] addingToDisposable:disposable];
 	return disposable;
 }
 
-- (void)scheduleRecursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock addingToDisposable:(RACCompoundDisposable *)disposable {
-	@autoreleasepool {
-		RACCompoundDisposable *selfDisposable = [RACCompoundDisposable compoundDisposable];
-		[disposable addDisposable:selfDisposable];
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block timerQueue:(dispatch_queue_t)timerQueue enqueue:(RACSchedulerEnqueueBlock)enqueue {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != NULL);
+	NSCParameterAssert(timerQueue != NULL);
+	NSCParameterAssert(enqueue != nil);
 
-		__weak RACDisposable *weakSelfDisposable = selfDisposable;
+	RACDisposable *disposable = [[RACDisposable alloc] init];
 
-		RACDisposable *schedulingDisposable = [self schedule:^{
-			@autoreleasepool {
-				// At this point, we've been invoked, so our disposable is now useless.
-				[disposable removeDisposable:weakSelfDisposable];
-			}
+	dispatch_after([RACQueueScheduler wallTimeWithDate:date], timerQueue, ^{
+		if (disposable.disposed) return;
 
+		enqueue(^{
 			if (disposable.disposed) return;
+			block();
+		});
+	});
 
-			void (^reallyReschedule)(void) = ^{
-				if (disposable.disposed) return;
-				[self scheduleRecursiveBlock:recursiveBlock addingToDisposable:disposable];
-			};
-
-			// Protects the variables below.
-			//
-			// This doesn't actually need to be __block qualified, but Clang
-			// complains otherwise. :C
-			__block NSLock *lock = [[NSLock alloc] init];
-			lock.name = [NSString stringWithFormat:@"%@ %s", self, sel_getName(_cmd)];
-
-			__block NSUInteger rescheduleCount = 0;
-
-			// Set to YES once synchronous execution has finished. Further
-			// rescheduling should occur immediately (rather than being
-			// flattened).
-			__block BOOL rescheduleImmediately = NO;
-
-			@autoreleasepool {
-				recursiveBlock(^{
-					[lock lock];
-					BOOL immediate = rescheduleImmediately;
-					if (!immediate) ++rescheduleCount;
-					[lock unlock];
-
-					if (immediate) reallyReschedule();
-				});
-			}
-
-			[lock lock];
-			NSUInteger synchronousCount = rescheduleCount;
-			rescheduleImmediately = YES;
-			[lock unlock];
-
-			for (NSUInteger i = 0; i < synchronousCount; i++) {
-				reallyReschedule();
-			}
-		}];
-
-		[selfDisposable addDisposable:schedulingDisposable];
-	}
+	return disposable;
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block timerQueue:(dispatch_queue_t)timerQueue enqueue:(RACSchedulerEnqueueBlock)enqueue {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(interval > 0.0 && interval < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(leeway >= 0.0 && leeway < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(block != NULL);
+	NSCParameterAssert(timerQueue != NULL);
+	NSCParameterAssert(enqueue != nil);
+
+	uint64_t intervalInNanoSecs = (uint64_t)(interval * NSEC_PER_SEC);
+	uint64_t leewayInNanoSecs = (uint64_t)(leeway * NSEC_PER_SEC);
+
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+	void (^tickBlock)(void) = ^{
+		if (disposable.disposed) return;
+		block();
+	};
+
+	dispatch_source_t timer = dispatch_source_create(DISPATCH_SOURCE_TYPE_TIMER, 0, 0, timerQueue);
+	dispatch_source_set_timer(timer, [RACQueueScheduler wallTimeWithDate:date], intervalInNanoSecs, leewayInNanoSecs);
+	dispatch_source_set_event_handler(timer, ^{
+		enqueue(tickBlock);
+	});
+	dispatch_resume(timer);
+
+	return [RACDisposable disposableWithBlock:^{
+		[disposable dispose];
+		dispatch_source_cancel(timer);
+	}];
 }
 
 - (void)performAsCurrentScheduler:(void (^)(void))block {
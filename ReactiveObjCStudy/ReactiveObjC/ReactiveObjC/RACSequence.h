@@ -62,6 +62,28 @@ NS_ASSUME_NONNULL_BEGIN
 // Returns a new lazy sequence, or the receiver if the sequence is already lazy.
 @property (nonatomic, copy, readonly) RACSequence<ValueType> *lazySequence;
 
+// Converts a sequence into a streaming sequence.
+//
+// A streaming sequence is single-pass, and doesn't memoize its values, so
+// enumerating it uses a constant amount of memory, even if it's very long. Each
+// value is handed to whichever consumer asks for it first, so a streaming
+// sequence should only ever have one consumer. Accessing -head or -tail of a
+// streaming sequence memoizes its remaining values.
+//
+// Values are only released as they're consumed if nothing else retains the
+// receiver.
+//
+// Returns a new streaming sequence, or the receiver if the sequence is already
+// streaming.
+@property (nonatomic, copy, readonly) RACSequence<ValueType> *streamingSequence;
+
+// Converts a sequence into a memoized sequence, whose values are retained once
+// they've been evaluated, so that it can be traversed any number of times.
+//
+// Returns a memoized sequence of the remaining values of a streaming sequence,
+// or the receiver otherwise.
+@property (nonatomic, copy, readonly) RACSequence<ValueType> *memoizedSequence;
+
 // Invokes -signalWithScheduler: with a new RACScheduler.
 - (RACSignal<ValueType> *)signal;
 
@@ -74,6 +96,27 @@ NS_ASSUME_NONNULL_BEGIN
 // they're evaluated.
 - (RACSignal<ValueType> *)signalWithScheduler:(RACScheduler *)scheduler;
 
+// Evaluates the full sequence on the given scheduler, in batches.
+//
+// Each scheduled block evaluates and sends up to `quantum` values, or as many
+// as fit within `timeBudget`, before yielding control of the scheduler. This
+// trades some fairness on the scheduler for far fewer scheduling round-trips
+// when sending large sequences.
+//
+// Array-backed sequences are sent directly from their backing storage, without
+// evaluating -tail for each value.
+//
+// scheduler  - The scheduler on which to evaluate the sequence. Cannot be nil.
+// quantum    - The maximum number of values to send from each scheduled block.
+//              Must be greater than zero.
+// timeBudget - The number of seconds after which a scheduled block yields, even
+//              if it hasn't sent `quantum` values yet. At least one value is
+//              always sent. A value of zero means no time limit.
+//
+// Returns a signal which sends the receiver's values on the given scheduler as
+// they're evaluated.
+- (RACSignal<ValueType> *)signalWithScheduler:(RACScheduler *)scheduler quantum:(NSUInteger)quantum timeBudget:(NSTimeInterval)timeBudget;
+
 // Applies a left fold to the sequence.
 //
 // This is the same as iterating the sequence along with a provided start value.
@@ -105,6 +148,12 @@ NS_ASSUME_NONNULL_BEGIN
 //          prevent unnecessary computation by not accessing `rest.head` if you
 //          don't need to.
 //
+// Evaluating `rest.head` nests the rest of the fold on the stack. Once folds
+// are nested more than 256 deep, the remainder of the sequence is evaluated in
+// full and folded iteratively instead, so folds over sequences of any length
+// use a bounded amount of stack. A fold over an infinite sequence must
+// therefore stop accessing `rest.head` within its first 256 values.
+//
 // Returns a reduced value.
 - (id)foldRightWithStart:(nullable id)start reduce:(id _Nullable (^)(id _Nullable first, RACSequence *rest))reduce;
 
@@ -129,6 +178,106 @@ NS_ASSUME_NONNULL_BEGIN
 // Returns an object that passes the block or nil if no objects passed.
 - (nullable ValueType)objectPassingTest:(BOOL (^)(ValueType _Nullable value))block;
 
+// Evaluates values of the sequence ahead of time on the given scheduler, so
+// that expensive values can be evaluated while earlier ones are being used.
+//
+// Evaluation begins immediately, and pauses whenever `count` values are
+// waiting to be used. Accessing a value which hasn't been evaluated yet blocks
+// until it has, so the returned sequence must not be used from `scheduler`
+// itself.
+//
+// count     - The maximum number of values to evaluate ahead of their use.
+//             Must be greater than zero.
+// scheduler - The scheduler on which to evaluate the receiver. Cannot be nil.
+//
+// Returns a lazy sequence of the receiver's values.
+- (RACSequence<ValueType> *)prefetch:(NSUInteger)count onScheduler:(RACScheduler *)scheduler;
+
+// Sorts the values in the sequence.
+//
+// The whole receiver is evaluated up front, and large sequences are sorted
+// concurrently, so `comparator` must be thread-safe. The sort is stable.
+//
+// comparator - The block used to compare values. Cannot be nil.
+//
+// Returns an array-backed sequence of the sorted values, which is eager if the
+// receiver is eager.
+- (RACSequence<ValueType> *)sortedWithComparator:(NSComparator)comparator;
+
+// Sorts the values in the sequence by a key derived from each value.
+//
+// The key for each value is computed only once, concurrently, and keys are
+// then compared using -compare:. The sort is stable.
+//
+// keyBlock - The block used to derive the key of each value. Cannot be nil,
+//            and must not return nil. This is invoked from multiple threads at
+//            once, so it must be thread-safe.
+//
+// Returns an array-backed sequence of the sorted values, which is eager if the
+// receiver is eager.
+- (RACSequence<ValueType> *)sortedByKey:(id (^)(ValueType _Nullable value))keyBlock;
+
+// Lazily merges the receiver with another sequence, where both are already
+// sorted according to `comparator`.
+//
+// sequence   - The sorted sequence to merge with the receiver. Cannot be nil.
+// comparator - The block used to compare values. Cannot be nil. When values
+//              compare equal, those from the receiver come first.
+//
+// Returns a lazy, sorted sequence of the values from both sequences.
+- (RACSequence<ValueType> *)mergeSortedWith:(RACSequence<ValueType> *)sequence comparator:(NSComparator)comparator;
+
+// Splits the sequence into consecutive arrays of values.
+//
+// size - The number of values in each array. Must be greater than zero. The
+//        last array will contain fewer values if the sequence doesn't divide
+//        evenly.
+//
+// Returns a sequence of arrays, each of which is evaluated only when needed.
+- (RACSequence<NSArray<ValueType> *> *)chunksOfSize:(NSUInteger)size;
+
+// Maps `block` over the values in the sequence, evaluating the block for
+// different values concurrently.
+//
+// Unlike -map:, the whole receiver is evaluated up front, and `block` is
+// invoked from multiple threads at once, so it must be thread-safe. The order
+// of the values is preserved.
+//
+// block - The block to apply to each value. Cannot be nil. Returning nil from
+//         the block omits that value from the result.
+//
+// Returns an array-backed sequence of the mapped values, which is eager if the
+// receiver is eager.
+- (RACSequence *)parallelMap:(id _Nullable (^)(ValueType _Nullable value))block;
+
+// Filters the values in the sequence, evaluating `block` for different values
+// concurrently.
+//
+// Unlike -filter:, the whole receiver is evaluated up front, and `block` is
+// invoked from multiple threads at once, so it must be thread-safe. The order
+// of the values is preserved.
+//
+// block - The block predicate used to check each value. Cannot be nil.
+//
+// Returns an array-backed sequence of the values which passed, which is eager
+// if the receiver is eager.
+- (RACSequence<ValueType> *)parallelFilter:(BOOL (^)(ValueType _Nullable value))block;
+
+// Combines the values in the sequence, evaluating separate runs of values
+// concurrently.
+//
+// Each run is folded from `start`, and the results of each run are then
+// combined in order, again starting from `start`. For the result to match that
+// of -foldLeftWithStart:reduce:, `combine` must be associative and `start` must
+// be its identity (e.g., @0 for addition).
+//
+// start   - The identity value of `combine`.
+// combine - The block used to combine two values. Cannot be nil. This is
+//           invoked from multiple threads at once, so it must be thread-safe.
+//
+// Returns the combined value, or `start` if the sequence is empty.
+- (id)parallelReduceWithStart:(nullable id)start combine:(id _Nullable (^)(id _Nullable first, id _Nullable second))combine;
+
 // Creates a sequence that dynamically generates its values.
 //
 // headBlock - Invoked the first time -head is accessed.
@@ -148,6 +297,36 @@ NS_ASSUME_NONNULL_BEGIN
 // tail. `headBlock` must not be nil.
 + (RACSequence<ValueType> *)sequenceWithHeadBlock:(ValueType _Nullable (^)(void))headBlock tailBlock:(nullable RACSequence<ValueType> *(^)(void))tailBlock;
 
+// Creates a sequence of the records in a file, delimited by a separator.
+//
+// The file is memory-mapped rather than read, so it can be much larger than
+// available memory. Each record is an NSData referring directly to the mapped
+// file, without being copied, and records are only found as the sequence is
+// evaluated. The contents of the file must not be changed while the sequence
+// or any of its records are in use.
+//
+// path      - The path of the file to map. Cannot be nil.
+// separator - The bytes which delimit records, which aren't included in the
+//             records themselves. A separator at the very end of the file
+//             doesn't produce an empty last record. Must not be empty.
+// error     - If not NULL, this may be set to any error that occurs.
+//
+// Returns a sequence of NSData records, or nil if the file couldn't be mapped.
++ (nullable RACSequence<NSData *> *)sequenceWithMappedFileAtPath:(NSString *)path recordSeparator:(NSData *)separator error:(NSError **)error;
+
+// Creates a sequence of fixed-length records in a file.
+//
+// As with +sequenceWithMappedFileAtPath:recordSeparator:error:, the file is
+// memory-mapped, and records refer directly to the mapped file.
+//
+// path         - The path of the file to map. Cannot be nil.
+// recordLength - The number of bytes in each record. Must be greater than zero.
+//                The last record is shorter if the file doesn't divide evenly.
+// error        - If not NULL, this may be set to any error that occurs.
+//
+// Returns a sequence of NSData records, or nil if the file couldn't be mapped.
++ (nullable RACSequence<NSData *> *)sequenceWithMappedFileAtPath:(NSString *)path recordLength:(NSUInteger)recordLength error:(NSError **)error;
+
 @end
 
 @interface RACSequence<__covariant ValueType> (RACStream)
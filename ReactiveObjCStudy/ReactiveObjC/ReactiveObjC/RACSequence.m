@@ -7,12 +7,18 @@
 //
 
 #import "RACSequence.h"
+#import "NSObject+RACDescription.h"
 #import "RACArraySequence.h"
+#import "RACCompoundDisposable.h"
 #import "RACDynamicSequence.h"
 #import "RACEagerSequence.h"
 #import "RACEmptySequence.h"
+#import "RACFusedSequence.h"
+#import "RACMappedFileSequence.h"
+#import "RACPrefetchQueue.h"
 #import "RACScheduler.h"
 #import "RACSignal.h"
+#import "RACStreamingSequence.h"
 #import "RACSubscriber.h"
 #import "RACTuple.h"
 #import "RACUnarySequence.h"
@@ -55,6 +61,14 @@
 
 @end
 
+// The number of right folds currently being evaluated within one another on
+// this thread.
+static __thread NSUInteger RACSequenceFoldRightDepth = 0;
+
+// The number of nested right folds after which the remainder of a fold is
+// evaluated iteratively.
+static const NSUInteger RACSequenceFoldRightDepthLimit = 256;
+
 @implementation RACSequence
 
 #pragma mark Lifecycle
@@ -63,6 +77,14 @@
 	return [[RACDynamicSequence sequenceWithHeadBlock:headBlock tailBlock:tailBlock] setNameWithFormat:@"+sequenceWithHeadBlock:tailBlock:"];
 }
 
++ (RACSequence *)sequenceWithMappedFileAtPath:(NSString *)path recordSeparator:(NSData *)separator error:(NSError **)error {
+	return [RACMappedFileSequence sequenceWithFileAtPath:path recordSeparator:separator error:error];
+}
+
++ (RACSequence *)sequenceWithMappedFileAtPath:(NSString *)path recordLength:(NSUInteger)recordLength error:(NSError **)error {
+	return [RACMappedFileSequence sequenceWithFileAtPath:path recordLength:recordLength error:error];
+}
+
 #pragma mark Class cluster primitives
 
 - (id)head {
@@ -162,6 +184,72 @@
 		setNameWithFormat:@"[%@] -zipWith: %@", self.name, sequence];
 }
 
+#pragma mark Fused operations
+
+// These operators don't depend on anything beyond the current value and their
+// own state, so they're fused into a single pass over the receiver, rather
+// than going through -bind:.
+
+- (RACSequence *)map:(id (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	return [[self sequenceByFusingStage:^{
+		return ^(id value, BOOL *stop) {
+			return block(value);
+		};
+	}] setNameWithFormat:@"[%@] -map:", self.name];
+}
+
+- (RACSequence *)filter:(BOOL (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	return [[self sequenceByFusingStage:^{
+		return ^ id (id value, BOOL *stop) {
+			return (block(value) ? value : nil);
+		};
+	}] setNameWithFormat:@"[%@] -filter:", self.name];
+}
+
+- (RACSequence *)skip:(NSUInteger)skipCount {
+	return [[self sequenceByFusingStage:^{
+		__block NSUInteger skipped = 0;
+
+		return ^ id (id value, BOOL *stop) {
+			if (skipped >= skipCount) return value;
+
+			skipped++;
+			return nil;
+		};
+	}] setNameWithFormat:@"[%@] -skip: %lu", self.name, (unsigned long)skipCount];
+}
+
+- (RACSequence *)take:(NSUInteger)count {
+	if (count == 0) return self.class.empty;
+
+	return [[self sequenceByFusingStage:^{
+		__block NSUInteger taken = 0;
+
+		return ^(id value, BOOL *stop) {
+			if (++taken == count) *stop = YES;
+			return value;
+		};
+	}] setNameWithFormat:@"[%@] -take: %lu", self.name, (unsigned long)count];
+}
+
+- (RACSequence *)scanWithStart:(id)startingValue reduceWithIndex:(id (^)(id, id, NSUInteger))reduceBlock {
+	NSCParameterAssert(reduceBlock != nil);
+
+	return [[self sequenceByFusingStage:^{
+		__block id running = startingValue;
+		__block NSUInteger index = 0;
+
+		return ^(id value, BOOL *stop) {
+			running = reduceBlock(running, value, index++);
+			return running;
+		};
+	}] setNameWithFormat:@"[%@] -scanWithStart: %@ reduceWithIndex:", self.name, RACDescription(startingValue)];
+}
+
 #pragma mark Extended methods
 
 - (NSArray *)array {
@@ -184,21 +272,45 @@
 }
 
 - (RACSignal *)signalWithScheduler:(RACScheduler *)scheduler {
+	return [[self signalWithScheduler:scheduler quantum:1 timeBudget:0] setNameWithFormat:@"[%@] -signalWithScheduler: %@", self.name, scheduler];
+}
+
+- (RACSignal *)signalWithScheduler:(RACScheduler *)scheduler quantum:(NSUInteger)quantum timeBudget:(NSTimeInterval)timeBudget {
+	NSCParameterAssert(scheduler != nil);
+	NSCParameterAssert(quantum > 0);
+	NSCParameterAssert(timeBudget >= 0 && timeBudget < INT64_MAX / NSEC_PER_SEC);
+
+	int64_t timeBudgetInNanoSecs = (int64_t)(timeBudget * NSEC_PER_SEC);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
-		__block RACSequence *sequence = self;
+		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
 
-		return [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
-			if (sequence.head == nil) {
-				[subscriber sendCompleted];
-				return;
-			}
+		// Subclasses may enumerate their storage more cheaply than by walking
+		// -tail, so pull values through -objectEnumerator.
+		NSEnumerator *enumerator = self.objectEnumerator;
+
+		RACDisposable *schedulingDisposable = [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+			dispatch_time_t deadline = (timeBudgetInNanoSecs > 0 ? dispatch_time(DISPATCH_TIME_NOW, timeBudgetInNanoSecs) : DISPATCH_TIME_FOREVER);
 
-			[subscriber sendNext:sequence.head];
+			for (NSUInteger sent = 0; sent < quantum; sent++) {
+				id value = [enumerator nextObject];
+				if (value == nil) {
+					[subscriber sendCompleted];
+					return;
+				}
+
+				[subscriber sendNext:value];
+
+				if (disposable.disposed) return;
+				if (deadline != DISPATCH_TIME_FOREVER && dispatch_time(DISPATCH_TIME_NOW, 0) >= deadline) break;
+			}
 
-			sequence = sequence.tail;
 			reschedule();
 		}];
-	}] setNameWithFormat:@"[%@] -signalWithScheduler: %@", self.name, scheduler];
+
+		[disposable addDisposable:schedulingDisposable];
+		return disposable;
+	}] setNameWithFormat:@"[%@] -signalWithScheduler: %@ quantum: %lu timeBudget: %f", self.name, scheduler, (unsigned long)quantum, timeBudget];
 }
 
 - (id)foldLeftWithStart:(id)start reduce:(id (^)(id, id))reduce {
@@ -219,16 +331,52 @@
 	if (self.head == nil) return start;
 	
 	RACSequence *rest = [RACSequence sequenceWithHeadBlock:^{
-		if (self.tail) {
-			return [self.tail foldRightWithStart:start reduce:reduce];
-		} else {
-			return start;
+		RACSequence *tail = self.tail;
+		if (tail == nil) return start;
+
+		// Each nested fold is evaluated on the stack, so past a certain depth,
+		// give up laziness and fold the remainder iteratively instead.
+		if (RACSequenceFoldRightDepth >= RACSequenceFoldRightDepthLimit) {
+			return [tail iterativeFoldRightWithStart:start reduce:reduce];
+		}
+
+		RACSequenceFoldRightDepth++;
+
+		@try {
+			return [tail foldRightWithStart:start reduce:reduce];
+		} @finally {
+			RACSequenceFoldRightDepth--;
 		}
 	} tailBlock:nil];
 	
 	return reduce(self.head, rest);
 }
 
+// Applies a right fold using a constant amount of stack, by evaluating the
+// whole sequence into an explicit stack of values, then reducing from the last
+// value backwards.
+- (id)iterativeFoldRightWithStart:(id)start reduce:(id (^)(id, RACSequence *))reduce {
+	// Fast enumeration evaluates lazy sequences one batch at a time, without
+	// recursing, so this is safe however long the sequence is.
+	NSMutableArray *values = [NSMutableArray array];
+	for (id value in self) {
+		[values addObject:value];
+	}
+
+	id result = start;
+
+	for (id value in values.reverseObjectEnumerator) {
+		id accumulated = result;
+		RACSequence *rest = [RACSequence sequenceWithHeadBlock:^{
+			return accumulated;
+		} tailBlock:nil];
+
+		result = reduce(value, rest);
+	}
+
+	return result;
+}
+
 - (BOOL)any:(BOOL (^)(id))block {
 	NSCParameterAssert(block != NULL);
 
@@ -251,6 +399,82 @@
 	return [self filter:block].head;
 }
 
+- (RACSequence *)prefetch:(NSUInteger)count onScheduler:(RACScheduler *)scheduler {
+	NSCParameterAssert(count > 0);
+	NSCParameterAssert(scheduler != nil);
+
+	RACPrefetchQueue *queue = [[RACPrefetchQueue alloc] initWithSequence:self capacity:count scheduler:scheduler];
+	return [[self.class sequenceWithPrefetchQueue:queue] setNameWithFormat:@"[%@] -prefetch: %lu onScheduler: %@", self.name, (unsigned long)count, scheduler];
+}
+
+// Returns a lazy sequence of the values remaining in the given queue.
++ (RACSequence *)sequenceWithPrefetchQueue:(RACPrefetchQueue *)queue {
+	// Each node only creates the next one after taking its own value, so
+	// values are always taken in order.
+	return [RACDynamicSequence sequenceWithLazyDependency:^{
+		return [queue takeValue];
+	} headBlock:^(id value) {
+		return value;
+	} tailBlock:^ RACSequence * (id value) {
+		if (value == nil) return nil;
+
+		return [self sequenceWithPrefetchQueue:queue];
+	}];
+}
+
+- (RACSequence *)mergeSortedWith:(RACSequence *)sequence comparator:(NSComparator)comparator {
+	NSCParameterAssert(sequence != nil);
+	NSCParameterAssert(comparator != nil);
+
+	return [[RACDynamicSequence sequenceWithLazyDependency:^ id {
+		id head = self.head;
+		id otherHead = sequence.head;
+		if (head == nil && otherHead == nil) return nil;
+
+		BOOL fromReceiver = (otherHead == nil || (head != nil && comparator(head, otherHead) != NSOrderedDescending));
+		return @(fromReceiver);
+	} headBlock:^ id (NSNumber *fromReceiver) {
+		if (fromReceiver == nil) return nil;
+
+		return (fromReceiver.boolValue ? self.head : sequence.head);
+	} tailBlock:^ RACSequence * (NSNumber *fromReceiver) {
+		if (fromReceiver == nil) return nil;
+
+		if (fromReceiver.boolValue) {
+			return [(self.tail ?: self.class.empty) mergeSortedWith:sequence comparator:comparator];
+		} else {
+			return [self mergeSortedWith:(sequence.tail ?: self.class.empty) comparator:comparator];
+		}
+	}] setNameWithFormat:@"[%@] -mergeSortedWith: %@ comparator:", self.name, sequence];
+}
+
+- (RACSequence *)chunksOfSize:(NSUInteger)size {
+	NSCParameterAssert(size > 0);
+
+	return [[RACDynamicSequence sequenceWithLazyDependency:^ id {
+		NSMutableArray *chunk = [NSMutableArray arrayWithCapacity:size];
+		RACSequence *rest = self;
+
+		while (chunk.count < size) {
+			id value = rest.head;
+			if (value == nil) break;
+
+			[chunk addObject:value];
+			rest = rest.tail;
+		}
+
+		if (chunk.count == 0) return nil;
+		return RACTuplePack([chunk copy], rest);
+	} headBlock:^(RACTuple *chunkAndRest) {
+		return chunkAndRest.first;
+	} tailBlock:^ RACSequence * (RACTuple *chunkAndRest) {
+		RACSequence *rest = chunkAndRest.second;
+		if (rest == nil) return nil;
+
+		return [rest chunksOfSize:size];
+	}] setNameWithFormat:@"[%@] -chunksOfSize: %lu", self.name, (unsigned long)size];
+}
+
 - (RACSequence *)eagerSequence {
 	return [RACEagerSequence sequenceWithArray:self.array offset:0];
 }
@@ -259,6 +483,184 @@
 	return self;
 }
 
+- (RACSequence *)streamingSequence {
+	__block RACSequence *rest = self;
+
+	return [[RACStreamingSequence sequenceWithGenerator:^ id {
+		id value = rest.head;
+
+		// Let go of each node as soon as it's been consumed.
+		rest = (value != nil ? rest.tail : nil);
+		return value;
+	}] setNameWithFormat:@"[%@] -streamingSequence", self.name];
+}
+
+- (RACSequence *)memoizedSequence {
+	return self;
+}
+
+#pragma mark Parallel operations
+
+// Splits `count` values into runs, and invokes `block` concurrently for each
+// run, returning once every run has been processed.
+//
+// Each run is large enough to be worth the cost of dispatching it, while
+// still leaving enough runs to keep every core busy if some finish early.
+static void RACParallelApply(NSUInteger count, void (^block)(NSRange range)) {
+	NSUInteger runCount = MIN(count, NSProcessInfo.processInfo.activeProcessorCount * 4);
+	if (runCount == 0) return;
+
+	NSUInteger runLength = (count + runCount - 1) / runCount;
+	runCount = (count + runLength - 1) / runLength;
+
+	dispatch_apply(runCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t run) {
+		NSUInteger location = run * runLength;
+
+		@autoreleasepool {
+			block(NSMakeRange(location, MIN(runLength, count - location)));
+		}
+	});
+}
+
+// Returns a sequence of the given values, which is eager if the receiver is.
+- (RACSequence *)sequenceWithParallelResults:(NSArray *)results {
+	Class sequenceClass = ([self isKindOfClass:RACEagerSequence.class] ? RACEagerSequence.class : RACArraySequence.class);
+	return [sequenceClass sequenceWithArray:results offset:0];
+}
+
+- (RACSequence *)parallelMap:(id (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	NSArray *values = self.array;
+	NSUInteger count = values.count;
+
+	// Each run writes to its own slots, so no synchronization is needed.
+	__strong id *mappedValues = (__strong id *)calloc(count, sizeof(id));
+
+	RACParallelApply(count, ^(NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+			mappedValues[i] = block(values[i]);
+		}
+	});
+
+	NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		if (mappedValues[i] != nil) [results addObject:mappedValues[i]];
+		mappedValues[i] = nil;
+	}
+
+	free(mappedValues);
+
+	return [[self sequenceWithParallelResults:results] setNameWithFormat:@"[%@] -parallelMap:", self.name];
+}
+
+- (RACSequence *)parallelFilter:(BOOL (^)(id value))block {
+	NSCParameterAssert(block != nil);
+
+	NSArray *values = self.array;
+	NSUInteger count = values.count;
+
+	// Each run writes to its own slots, so no synchronization is needed.
+	BOOL *passed = (BOOL *)calloc(count, sizeof(BOOL));
+
+	RACParallelApply(count, ^(NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+			passed[i] = block(values[i]);
+		}
+	});
+
+	NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		if (passed[i]) [results addObject:values[i]];
+	}
+
+	free(passed);
+
+	return [[self sequenceWithParallelResults:results] setNameWithFormat:@"[%@] -parallelFilter:", self.name];
+}
+
+- (RACSequence *)sortedWithComparator:(NSComparator)comparator {
+	NSCParameterAssert(comparator != nil);
+
+	// Foundation already implements a concurrent merge sort, which is also
+	// stable.
+	NSArray *sorted = [self.array sortedArrayWithOptions:NSSortConcurrent | NSSortStable usingComparator:comparator];
+
+	return [[self sequenceWithParallelResults:sorted] setNameWithFormat:@"[%@] -sortedWithComparator:", self.name];
+}
+
+- (RACSequence *)sortedByKey:(id (^)(id value))keyBlock {
+	NSCParameterAssert(keyBlock != nil);
+
+	NSArray *values = self.array;
+	NSUInteger count = values.count;
+
+	// Each run writes to its own slots, so no synchronization is needed.
+	__strong id *keys = (__strong id *)calloc(count, sizeof(id));
+
+	RACParallelApply(count, ^(NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+			keys[i] = keyBlock(values[i]);
+			NSCAssert(keys[i] != nil, @"Key block returned nil for value %@", values[i]);
+		}
+	});
+
+	NSMutableArray *indexes = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger i = 0; i < count; i++) {
+		[indexes addObject:@(i)];
+	}
+
+	[indexes sortWithOptions:NSSortConcurrent | NSSortStable usingComparator:^(NSNumber *first, NSNumber *second) {
+		return [keys[first.unsignedIntegerValue] compare:keys[second.unsignedIntegerValue]];
+	}];
+
+	NSMutableArray *sorted = [NSMutableArray arrayWithCapacity:count];
+	for (NSNumber *index in indexes) {
+		[sorted addObject:values[index.unsignedIntegerValue]];
+	}
+
+	for (NSUInteger i = 0; i < count; i++) {
+		keys[i] = nil;
+	}
+
+	free(keys);
+
+	return [[self sequenceWithParallelResults:sorted] setNameWithFormat:@"[%@] -sortedByKey:", self.name];
+}
+
+- (id)parallelReduceWithStart:(id)start combine:(id (^)(id, id))combine {
+	NSCParameterAssert(combine != nil);
+
+	NSArray *values = self.array;
+	NSUInteger count = values.count;
+	if (count == 0) return start;
+
+	// The result of each run, stored by the index of its first value.
+	__strong id *runResults = (__strong id *)calloc(count, sizeof(id));
+	BOOL *hasRunResult = (BOOL *)calloc(count, sizeof(BOOL));
+
+	RACParallelApply(count, ^(NSRange range) {
+		id accumulator = start;
+		for (NSUInteger i = range.location; i < NSMaxRange(range); i++) {
+			accumulator = combine(accumulator, values[i]);
+		}
+
+		runResults[range.location] = accumulator;
+		hasRunResult[range.location] = YES;
+	});
+
+	id result = start;
+	for (NSUInteger i = 0; i < count; i++) {
+		if (hasRunResult[i]) result = combine(result, runResults[i]);
+		runResults[i] = nil;
+	}
+
+	free(runResults);
+	free(hasRunResult);
+
+	return result;
+}
+
 #pragma mark NSCopying
 
 - (id)copyWithZone:(NSZone *)zone {
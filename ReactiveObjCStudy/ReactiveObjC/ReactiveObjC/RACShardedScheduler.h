@@ -0,0 +1,63 @@
+//
+//  RACShardedScheduler.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACScheduler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// A serial scheduler representing one shard of a fixed group of schedulers.
+//
+// Each shard owns a dedicated thread, and every block scheduled on the shard
+// executes on that thread. Unlike GCD queues, whose blocks may migrate between
+// threads and processors from one execution to the next, a pipeline delivered
+// on a shard keeps its state on a single thread, which keeps it warm in that
+// processor's caches.
+//
+// Where the platform supports it, each shard's thread is also given a distinct
+// affinity tag, hinting to the kernel that shards should be spread across
+// processors. This is only a hint, and is ignored on platforms which do not
+// support thread affinity.
+//
+// Use -schedulerForKey: to consistently route related work to the same shard.
+//
+// Shard threads are never torn down, so a group should be created once and
+// kept for the life of the process.
+@interface RACShardedScheduler : RACScheduler
+
+// The number of shards in the receiver's group.
+@property (nonatomic, assign, readonly) NSUInteger shardCount;
+
+// The index of the receiver within its group.
+@property (nonatomic, assign, readonly) NSUInteger shardIndex;
+
+// Initializes the receiver with a new group of shards, as the scheduler for
+// shard 0.
+//
+// name       - The name of the group, also used to name each shard and its
+//              thread. If nil, a default name will be used.
+// shardCount - The number of shards to create. If zero, one shard is created
+//              for each active processor.
+//
+// Returns the initialized object.
+- (instancetype)initWithName:(nullable NSString *)name shardCount:(NSUInteger)shardCount;
+
+// Returns the shard at the given index of the receiver's group.
+//
+// index - The index of the shard. Must be less than `shardCount`.
+- (RACShardedScheduler *)schedulerForShard:(NSUInteger)index;
+
+// Returns the shard which work relating to the given key should be delivered
+// on. The same key, or any key which is equal to it, always maps to the same
+// shard of a group.
+//
+// key - The object to pick a shard for. Must not be nil.
+- (RACShardedScheduler *)schedulerForKey:(id<NSObject>)key;
+
+@end
+
+NS_ASSUME_NONNULL_END
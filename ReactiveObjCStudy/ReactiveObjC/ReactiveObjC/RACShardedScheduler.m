@@ -0,0 +1,209 @@
+//
+//  RACShardedScheduler.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACShardedScheduler.h"
+#import "RACScheduler+Private.h"
+#import "RACScheduler+Subclass.h"
+#import <mach/mach.h>
+#import <mach/thread_policy.h>
+#import <pthread.h>
+
+// The state shared by every shard of a group.
+@interface RACShardedSchedulerGroup : NSObject
+
+// The shards of the group, in order.
+@property (nonatomic, copy) NSArray<RACShardedScheduler *> *shards;
+
+// A serial queue used to fire timers, which then enqueue their blocks on the
+// appropriate shard.
+@property (nonatomic, strong, readonly) dispatch_queue_t timerQueue;
+
+- (instancetype)initWithName:(NSString *)name;
+
+@end
+
+@implementation RACShardedSchedulerGroup
+
+- (instancetype)initWithName:(NSString *)name {
+	self = [super init];
+
+	_timerQueue = dispatch_queue_create([name stringByAppendingString:@".timers"].UTF8String, DISPATCH_QUEUE_SERIAL);
+
+	return self;
+}
+
+@end
+
+@interface RACShardedScheduler ()
+
+@property (nonatomic, strong, readonly) RACShardedSchedulerGroup *group;
+
+- (instancetype)initWithName:(NSString *)name group:(RACShardedSchedulerGroup *)group index:(NSUInteger)index;
+
+@end
+
+@implementation RACShardedScheduler {
+	// Protects _queue.
+	pthread_mutex_t _mutex;
+
+	// Signaled when a block is added to an empty _queue.
+	pthread_cond_t _condition;
+
+	// Blocks waiting to be executed, in order.
+	NSMutableArray *_queue;
+
+	// The name given to the receiver, which is also used for its thread.
+	NSString *_shardName;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithName:(NSString *)name shardCount:(NSUInteger)shardCount {
+	if (name == nil) name = @"org.reactivecocoa.ReactiveObjC.RACShardedScheduler";
+	if (shardCount == 0) shardCount = NSProcessInfo.processInfo.activeProcessorCount;
+
+	RACShardedSchedulerGroup *group = [[RACShardedSchedulerGroup alloc] initWithName:name];
+
+	self = [self initWithName:[name stringByAppendingString:@".shard-0"] group:group index:0];
+
+	NSMutableArray *shards = [NSMutableArray arrayWithCapacity:shardCount];
+	[shards addObject:self];
+
+	for (NSUInteger i = 1; i < shardCount; i++) {
+		NSString *shardName = [NSString stringWithFormat:@"%@.shard-%lu", name, (unsigned long)i];
+		[shards addObject:[[RACShardedScheduler alloc] initWithName:shardName group:group index:i]];
+	}
+
+	group.shards = shards;
+
+	for (RACShardedScheduler *shard in shards) {
+		[shard startThread];
+	}
+
+	return self;
+}
+
+- (instancetype)initWithName:(NSString *)name group:(RACShardedSchedulerGroup *)group index:(NSUInteger)index {
+	NSCParameterAssert(group != nil);
+
+	self = [super initWithName:name];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	pthread_cond_init(&_condition, NULL);
+
+	_group = group;
+	_shardIndex = index;
+	_shardName = [name copy];
+	_queue = [[NSMutableArray alloc] init];
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_cond_destroy(&_condition);
+
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+- (RACShardedScheduler *)schedulerForShard:(NSUInteger)index {
+	NSCParameterAssert(index < self.shardCount);
+
+	return self.group.shards[index];
+}
+
+- (RACShardedScheduler *)schedulerForKey:(id<NSObject>)key {
+	NSCParameterAssert(key != nil);
+
+	// Many -hash implementations (NSNumber's in particular) leave the low bits
+	// poorly distributed, so mix the bits before picking a shard.
+	uint64_t hash = key.hash;
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+
+	return self.group.shards[hash % self.shardCount];
+}
+
+#pragma mark Properties
+
+- (NSUInteger)shardCount {
+	return self.group.shards.count;
+}
+
+#pragma mark Execution
+
+- (void)startThread {
+	NSThread *thread = [[NSThread alloc] initWithBlock:^{
+		[self runThread];
+	}];
+
+	thread.name = _shardName;
+	[thread start];
+}
+
+- (void)runThread {
+	// Affinity tags are only a hint, and aren't supported on every platform,
+	// so failure here is expected and harmless.
+	thread_affinity_policy_data_t policy = { .affinity_tag = (integer_t)self.shardIndex + 1 };
+	thread_policy_set(pthread_mach_thread_np(pthread_self()), THREAD_AFFINITY_POLICY, (thread_policy_t)&policy, THREAD_AFFINITY_POLICY_COUNT);
+
+	while (YES) {
+		@autoreleasepool {
+			pthread_mutex_lock(&_mutex);
+
+			while (_queue.count == 0) {
+				pthread_cond_wait(&_condition, &_mutex);
+			}
+
+			// Take everything that's pending at once, so that producers only
+			// contend for the lock once per batch.
+			NSArray *blocks = _queue;
+			_queue = [[NSMutableArray alloc] init];
+
+			pthread_mutex_unlock(&_mutex);
+
+			for (void (^block)(void) in blocks) {
+				[self performAsCurrentScheduler:block];
+			}
+		}
+	}
+}
+
+- (void)enqueue:(void (^)(void))block {
+	pthread_mutex_lock(&_mutex);
+
+	[_queue addObject:[block copy]];
+	if (_queue.count == 1) pthread_cond_signal(&_condition);
+
+	pthread_mutex_unlock(&_mutex);
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	return [self schedule:block enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock];
+	}];
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	return [self after:date schedule:block timerQueue:self.group.timerQueue enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock];
+	}];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	return [self after:date repeatingEvery:interval withLeeway:leeway schedule:block timerQueue:self.group.timerQueue enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock];
+	}];
+}
+
+@end
@@ -0,0 +1,54 @@
+//
+//  RACSharedTimer.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RACDisposable;
+@class RACScheduler;
+
+// Private class that fans out the ticks of a single repeating timer to any
+// number of observers.
+//
+// One timer exists for each distinct combination of scheduler, interval,
+// leeway and alignment which currently has observers, and it retains its
+// scheduler until its last observer is disposed. Aligned timers tick on
+// multiples of their interval, so that timers with the same or related periods
+// fire together.
+@interface RACSharedTimer : NSObject
+
+// Invokes -observeInterval:leeway:aligned:onScheduler:block: with `aligned` set
+// to YES.
++ (RACDisposable *)observeInterval:(NSTimeInterval)interval leeway:(NSTimeInterval)leeway onScheduler:(RACScheduler *)scheduler block:(void (^)(NSDate *date))block;
+
+// Invokes the given block on `scheduler` every `interval` seconds, using the
+// shared timer for those parameters.
+//
+// An unaligned timer first ticks `interval` seconds after it's started by its
+// first observer. Any observer which joins it later skips the ticks which come
+// sooner than `interval` seconds after joining, so no observer is ever invoked
+// more often than it would be by a timer of its own.
+//
+// interval  - The interval between ticks. Must be greater than zero.
+// leeway    - The leeway allowed for each tick.
+// aligned   - Whether the timer ticks on multiples of `interval` since the
+//             reference date.
+// scheduler - The scheduler which the timer runs on. Cannot be nil.
+// block     - Invoked on every tick with the current date. Cannot be nil.
+//
+// Returns a disposable which stops invoking `block`. Once every observer of
+// a timer has been disposed, the timer is cancelled.
++ (RACDisposable *)observeInterval:(NSTimeInterval)interval leeway:(NSTimeInterval)leeway aligned:(BOOL)aligned onScheduler:(RACScheduler *)scheduler block:(void (^)(NSDate *date))block;
+
+// Returns the date of the first aligned tick for a timer with the given
+// interval, if it were started now.
+//
+// This is the next multiple of `interval` since the reference date which is at
+// least half of `interval` away, so that the first tick can't fire immediately.
++ (NSDate *)firstTickDateWithInterval:(NSTimeInterval)interval;
+
+@end
@@ -0,0 +1,143 @@
+//
+//  RACSharedTimer.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACSharedTimer.h"
+#import "RACDisposable.h"
+#import "RACScheduler.h"
+#import <pthread.h>
+
+// Protects RACSharedTimers and the observers of every timer.
+static pthread_mutex_t RACSharedTimersMutex = PTHREAD_MUTEX_INITIALIZER;
+
+// The live timers, keyed by an array of their scheduler, interval, leeway and
+// alignment.
+// The key retains the scheduler, so that a new scheduler allocated at the same
+// address can never be mistaken for it.
+static NSMutableDictionary<NSArray *, RACSharedTimer *> *RACSharedTimers = nil;
+
+@interface RACSharedTimer ()
+
+// The key of the receiver in RACSharedTimers.
+@property (nonatomic, copy, readonly) NSArray *key;
+
+@end
+
+@implementation RACSharedTimer {
+	// The blocks to invoke on every tick. This array is replaced, rather than
+	// mutated, so that ticks can enumerate it outside of the lock.
+	NSArray<void (^)(NSDate *)> *_observers;
+
+	// Disposes of the underlying timer.
+	RACDisposable *_timerDisposable;
+}
+
+- (instancetype)initWithKey:(NSArray *)key {
+	self = [super init];
+
+	_key = [key copy];
+	_observers = @[];
+
+	return self;
+}
+
++ (NSDate *)firstTickDateWithInterval:(NSTimeInterval)interval {
+	NSCParameterAssert(interval > 0.0);
+
+	NSTimeInterval now = NSDate.timeIntervalSinceReferenceDate;
+	NSTimeInterval start = ceil(now / interval) * interval;
+
+	if (start - now < interval / 2) start += interval;
+
+	return [NSDate dateWithTimeIntervalSinceReferenceDate:start];
+}
+
+// Starts the underlying timer, with its first tick either on the next multiple
+// of `interval` since the reference date, or `interval` from now.
+- (void)startWithInterval:(NSTimeInterval)interval leeway:(NSTimeInterval)leeway aligned:(BOOL)aligned scheduler:(RACScheduler *)scheduler {
+	NSDate *firstTickDate = (aligned ? [self.class firstTickDateWithInterval:interval] : [NSDate dateWithTimeIntervalSinceNow:interval]);
+
+	_timerDisposable = [scheduler after:firstTickDate repeatingEvery:interval withLeeway:leeway schedule:^{
+		pthread_mutex_lock(&RACSharedTimersMutex);
+		NSArray *observers = self->_observers;
+		pthread_mutex_unlock(&RACSharedTimersMutex);
+
+		// Every observer shares one date per tick.
+		NSDate *date = [NSDate date];
+		for (void (^observer)(NSDate *) in observers) {
+			observer(date);
+		}
+	}];
+}
+
++ (RACDisposable *)observeInterval:(NSTimeInterval)interval leeway:(NSTimeInterval)leeway onScheduler:(RACScheduler *)scheduler block:(void (^)(NSDate *date))block {
+	return [self observeInterval:interval leeway:leeway aligned:YES onScheduler:scheduler block:block];
+}
+
++ (RACDisposable *)observeInterval:(NSTimeInterval)interval leeway:(NSTimeInterval)leeway aligned:(BOOL)aligned onScheduler:(RACScheduler *)scheduler block:(void (^)(NSDate *date))block {
+	NSCParameterAssert(interval > 0.0);
+	NSCParameterAssert(scheduler != nil);
+	NSCParameterAssert(block != nil);
+
+	NSArray *key = @[ scheduler, @(interval), @(leeway), @(aligned) ];
+
+	pthread_mutex_lock(&RACSharedTimersMutex);
+
+	if (RACSharedTimers == nil) RACSharedTimers = [[NSMutableDictionary alloc] init];
+
+	RACSharedTimer *timer = RACSharedTimers[key];
+	BOOL needsStart = (timer == nil);
+
+	if (needsStart) {
+		timer = [[RACSharedTimer alloc] initWithKey:key];
+		RACSharedTimers[key] = timer;
+	}
+
+	// An unaligned timer which is already running may tick sooner than
+	// `interval` from now, which a timer of the observer's own never would.
+	NSDate *earliestDate = (aligned || needsStart ? nil : [NSDate dateWithTimeIntervalSinceNow:interval]);
+
+	RACDisposable *observerDisposable = [[RACDisposable alloc] init];
+	void (^observer)(NSDate *) = ^(NSDate *date) {
+		if (observerDisposable.disposed) return;
+		if (earliestDate != nil && [date compare:earliestDate] == NSOrderedAscending) return;
+
+		block(date);
+	};
+
+	timer->_observers = [timer->_observers arrayByAddingObject:observer];
+
+	// Start the timer under the lock, so that a concurrent disposal can't
+	// find it without its disposable.
+	if (needsStart) [timer startWithInterval:interval leeway:leeway aligned:aligned scheduler:scheduler];
+
+	pthread_mutex_unlock(&RACSharedTimersMutex);
+
+	return [RACDisposable disposableWithBlock:^{
+		[observerDisposable dispose];
+
+		pthread_mutex_lock(&RACSharedTimersMutex);
+
+		NSMutableArray *observers = [timer->_observers mutableCopy];
+		[observers removeObjectIdenticalTo:observer];
+		timer->_observers = [observers copy];
+
+		RACDisposable *timerDisposable = nil;
+		if (observers.count == 0) {
+			timerDisposable = timer->_timerDisposable;
+			timer->_timerDisposable = nil;
+
+			if (RACSharedTimers[timer.key] == timer) [RACSharedTimers removeObjectForKey:timer.key];
+		}
+
+		pthread_mutex_unlock(&RACSharedTimersMutex);
+
+		[timerDisposable dispose];
+	}];
+}
+
+@end
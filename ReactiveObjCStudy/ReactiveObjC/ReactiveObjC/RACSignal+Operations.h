@@ -353,6 +353,12 @@ typedef NS_ERROR_ENUM(RACSignalErrorDomain, RACSignalError) {
 // interest of performance or power consumption. Note that some additional
 // latency is to be expected, even when specifying a `leeway` of 0.
 //
+// On GCD-based schedulers, all subscriptions with the same interval, leeway and
+// scheduler share a single timer, which first fires `interval` seconds after
+// the earliest of them. A subscription which joins a running timer skips any
+// tick sooner than `interval` seconds away, so its first `next` may be deferred
+// by up to another `interval`.
+//
 // interval  - The base interval between `next`s.
 // scheduler - The scheduler upon which the current NSDate should be sent. This
 //             must not be nil or +[RACScheduler immediateScheduler].
@@ -363,6 +369,60 @@ typedef NS_ERROR_ENUM(RACSignalErrorDomain, RACSignalError) {
 // `scheduler`.
 + (RACSignal<NSDate *> *)interval:(NSTimeInterval)interval onScheduler:(RACScheduler *)scheduler withLeeway:(NSTimeInterval)leeway RAC_WARN_UNUSED_RESULT;
 
+// Like +interval:onScheduler:withLeeway:, but with ticks aligned to multiples
+// of `interval` since the reference date, so that periodic work with the same
+// or related periods wakes up together.
+//
+// Timers are shared between subscriptions in the same way, but joining one
+// doesn't skip any ticks.
+//
+// Because of the alignment, the first `next` is sent after between half and
+// one and a half times `interval`, rather than after `interval`.
+//
+// interval  - The base interval between `next`s.
+// scheduler - The scheduler upon which the current NSDate should be sent. This
+//             must not be nil or +[RACScheduler immediateScheduler].
+// leeway    - The maximum amount of additional time the `next` can be deferred.
+//
+// Returns a signal that sends the current date/time at aligned intervals on
+// `scheduler`.
++ (RACSignal<NSDate *> *)alignedInterval:(NSTimeInterval)interval onScheduler:(RACScheduler *)scheduler withLeeway:(NSTimeInterval)leeway RAC_WARN_UNUSED_RESULT;
+
+// Sends the number of ticks which have elapsed, starting from 1, at intervals
+// of at least `interval` seconds, up to approximately `interval` + `leeway`
+// seconds.
+//
+// Unlike +interval:onScheduler:withLeeway:, the interval is measured with
+// a monotonic clock, so it is unaffected by changes to the system wall clock,
+// and no NSDate is created for each tick.
+//
+// interval  - The base interval between `next`s. Must be greater than zero.
+// scheduler - The scheduler upon which the tick count should be sent. This
+//             must not be nil or +[RACScheduler immediateScheduler].
+// leeway    - The maximum amount of additional time the `next` can be deferred.
+//
+// Returns a signal that sends an NSNumber of the tick count on `scheduler`.
++ (RACSignal<NSNumber *> *)ticksWithInterval:(NSTimeInterval)interval onScheduler:(RACScheduler *)scheduler withLeeway:(NSTimeInterval)leeway RAC_WARN_UNUSED_RESULT;
+
+// Pairs each `next` from the receiver with the time at which it was received.
+//
+// Times are read from RACMonotonicTime(), so they are only meaningful relative
+// to one another.
+//
+// Returns a signal which sends a RACTuple of each value and an NSNumber of the
+// monotonic time in nanoseconds.
+- (RACSignal<RACTwoTuple<ValueType, NSNumber *> *> *)timestamp RAC_WARN_UNUSED_RESULT;
+
+// Pairs each `next` from the receiver with the time which elapsed since the
+// previous `next`, or since subscription for the first one.
+//
+// Intervals are measured with a monotonic clock, so they are unaffected by
+// changes to the system wall clock.
+//
+// Returns a signal which sends a RACTuple of each value and an NSNumber of the
+// elapsed time in seconds.
+- (RACSignal<RACTwoTuple<ValueType, NSNumber *> *> *)timeInterval RAC_WARN_UNUSED_RESULT;
+
 // Takes `next`s until the `signalTrigger` sends `next` or `completed`.
 //
 // Returns a signal which passes through all events from the receiver until
@@ -16,14 +16,17 @@
 #import "RACEvent.h"
 #import "RACGroupedSignal.h"
 #import "RACMulticastConnection+Private.h"
+#import "RACQueueScheduler.h"
 #import "RACReplaySubject.h"
 #import "RACScheduler.h"
 #import "RACSerialDisposable.h"
+#import "RACSharedTimer.h"
 #import "RACSignalSequence.h"
 #import "RACStream+Private.h"
 #import "RACSubject.h"
 #import "RACSubscriber+Private.h"
 #import "RACSubscriber.h"
+#import "RACTrampolineScheduler.h"
 #import "RACTuple.h"
 #import "RACUnit.h"
 #import <libkern/OSAtomic.h>
@@ -726,13 +729,87 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 	NSCParameterAssert(scheduler != nil);
 	NSCParameterAssert(scheduler != RACScheduler.immediateScheduler);
 
+	// Every subscription on a GCD-based scheduler would otherwise create its
+	// own dispatch source, so share one timer between all such subscriptions.
+	BOOL sharesTimer = (interval > 0.0 && [scheduler isKindOfClass:RACQueueScheduler.class]);
+
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		if (sharesTimer) {
+			return [RACSharedTimer observeInterval:interval leeway:leeway aligned:NO onScheduler:scheduler block:^(NSDate *date) {
+				[subscriber sendNext:date];
+			}];
+		}
+
 		return [scheduler after:[NSDate dateWithTimeIntervalSinceNow:interval] repeatingEvery:interval withLeeway:leeway schedule:^{
 			[subscriber sendNext:[NSDate date]];
 		}];
 	}] setNameWithFormat:@"+interval: %f onScheduler: %@ withLeeway: %f", (double)interval, scheduler, (double)leeway];
 }
 
++ (RACSignal *)alignedInterval:(NSTimeInterval)interval onScheduler:(RACScheduler *)scheduler withLeeway:(NSTimeInterval)leeway {
+	NSCParameterAssert(interval > 0.0);
+	NSCParameterAssert(scheduler != nil);
+	NSCParameterAssert(scheduler != RACScheduler.immediateScheduler);
+
+	// Shares timers like +interval:onScheduler:withLeeway: does.
+	BOOL sharesTimer = [scheduler isKindOfClass:RACQueueScheduler.class];
+
+	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		if (sharesTimer) {
+			return [RACSharedTimer observeInterval:interval leeway:leeway aligned:YES onScheduler:scheduler block:^(NSDate *date) {
+				[subscriber sendNext:date];
+			}];
+		}
+
+		return [scheduler after:[RACSharedTimer firstTickDateWithInterval:interval] repeatingEvery:interval withLeeway:leeway schedule:^{
+			[subscriber sendNext:[NSDate date]];
+		}];
+	}] setNameWithFormat:@"+alignedInterval: %f onScheduler: %@ withLeeway: %f", (double)interval, scheduler, (double)leeway];
+}
+
++ (RACSignal *)ticksWithInterval:(NSTimeInterval)interval onScheduler:(RACScheduler *)scheduler withLeeway:(NSTimeInterval)leeway {
+	NSCParameterAssert(interval > 0.0 && interval < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(leeway >= 0.0 && leeway < INT64_MAX / NSEC_PER_SEC);
+	NSCParameterAssert(scheduler != nil);
+	NSCParameterAssert(scheduler != RACScheduler.immediateScheduler);
+
+	uint64_t intervalInNanoSecs = (uint64_t)(interval * NSEC_PER_SEC);
+	uint64_t leewayInNanoSecs = (uint64_t)(leeway * NSEC_PER_SEC);
+
+	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		__block unsigned long long ticks = 0;
+
+		return [scheduler afterNanoseconds:intervalInNanoSecs repeatingEveryNanoseconds:intervalInNanoSecs withLeewayNanoseconds:leewayInNanoSecs schedule:^{
+			// Small NSNumbers are tagged pointers, so this doesn't allocate.
+			[subscriber sendNext:@(++ticks)];
+		}];
+	}] setNameWithFormat:@"+ticksWithInterval: %f onScheduler: %@ withLeeway: %f", (double)interval, scheduler, (double)leeway];
+}
+
+- (RACSignal *)timestamp {
+	return [[self map:^(id value) {
+		return RACTuplePack(value, @(RACMonotonicTime()));
+	}] setNameWithFormat:@"[%@] -timestamp", self.name];
+}
+
+- (RACSignal *)timeInterval {
+	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
+		__block uint64_t previousTime = RACMonotonicTime();
+
+		return [self subscribeNext:^(id x) {
+			uint64_t now = RACMonotonicTime();
+			NSTimeInterval elapsed = (NSTimeInterval)(now - previousTime) / NSEC_PER_SEC;
+			previousTime = now;
+
+			[subscriber sendNext:RACTuplePack(x, @(elapsed))];
+		} error:^(NSError *error) {
+			[subscriber sendError:error];
+		} completed:^{
+			[subscriber sendCompleted];
+		}];
+	}] setNameWithFormat:@"[%@] -timeInterval", self.name];
+}
+
 - (RACSignal *)takeUntil:(RACSignal *)signalTrigger {
 	return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
 		RACCompoundDisposable *disposable = [RACCompoundDisposable compoundDisposable];
@@ -908,6 +985,16 @@ static RACDisposable *subscribeForever (RACSignal *signal, void (^next)(id), voi
 		[condition unlock];
 	}];
 
+	// The subscription may have been deferred behind the trampolined block this
+	// is running in, which can't return until we stop waiting.
+	[(RACTrampolineScheduler *)RACScheduler.trampolineScheduler drainQueueUntil:^{
+		[condition lock];
+		BOOL finished = done;
+		[condition unlock];
+
+		return finished;
+	}];
+
 	[condition lock];
 	while (!done) {
 		[condition wait];
@@ -593,6 +593,71 @@ typedef RACSignal *_Nullable (^RACSignalBindBlock)(ValueType _Nullable value, BO
 
 @end
 
+// How -subscribe: performs a subscription when it is invoked from a thread
+// that has no +[RACScheduler currentScheduler], such as a GCD queue or a
+// thread created by the caller.
+//
+// RACSubscriptionPolicyInherit     - Use +[RACSignal defaultSubscriptionPolicy],
+//                                    or stay synchronous when already inside a
+//                                    synchronous subscription. Only meaningful
+//                                    as a per-signal policy.
+// RACSubscriptionPolicyBackground  - Subscribe on a private background
+//                                    scheduler. This is the default.
+// RACSubscriptionPolicySynchronous - Subscribe immediately on the calling
+//                                    thread. +[RACScheduler currentScheduler]
+//                                    stays nil for the duration, so operators
+//                                    which need a scheduler fall back to a
+//                                    private background scheduler. Deeply
+//                                    nested subscriptions are deferred until
+//                                    the stack unwinds, so blocking operators
+//                                    like -first must not be used from within
+//                                    them.
+typedef NS_ENUM(NSInteger, RACSubscriptionPolicy) {
+	RACSubscriptionPolicyInherit,
+	RACSubscriptionPolicyBackground,
+	RACSubscriptionPolicySynchronous,
+};
+
+// Counts of how subscriptions have been performed, as reported by
+// +[RACSignal subscriptionStatistics].
+//
+// immediate   - Subscriptions made with a valid +[RACScheduler currentScheduler],
+//               which always happen immediately.
+// synchronous - Subscriptions made without a current scheduler that were
+//               performed on the calling thread because of their policy.
+// hopped      - Subscriptions made without a current scheduler that were
+//               bounced to a background scheduler.
+typedef struct {
+	uint64_t immediate;
+	uint64_t synchronous;
+	uint64_t hopped;
+} RACSubscriptionStatistics;
+
+@interface RACSignal<__covariant ValueType> (SubscriptionPolicy)
+
+// The policy used for subscriptions to signals which don't specify their own.
+//
+// Defaults to RACSubscriptionPolicyBackground. This must not be set to
+// RACSubscriptionPolicyInherit.
+@property (class, atomic, assign) RACSubscriptionPolicy defaultSubscriptionPolicy;
+
+// Returns a signal which subscribes to the receiver according to `policy`.
+//
+// With RACSubscriptionPolicySynchronous, any subscriptions made while the
+// receiver is being subscribed to (for instance, to the inner signals of
+// -concat: or -flattenMap:) will also be performed on the calling thread,
+// unless they explicitly specify a different policy.
+- (RACSignal<ValueType> *)subscriptionPolicy:(RACSubscriptionPolicy)policy RAC_WARN_UNUSED_RESULT;
+
+// Returns the number of subscriptions performed in each way since launch, or
+// since the last call to +resetSubscriptionStatistics.
++ (RACSubscriptionStatistics)subscriptionStatistics;
+
+// Resets all of the counters returned by +subscriptionStatistics to zero.
++ (void)resetSubscriptionStatistics;
+
+@end
+
 // Additional methods to assist with debugging.
 @interface RACSignal<__covariant ValueType> (Debugging)
 
@@ -8,6 +8,7 @@
 
 #import "RACSignal.h"
 #import "RACCompoundDisposable.h"
+#import "RACConcatSignal.h"
 #import "RACDisposable.h"
 #import "RACDynamicSignal.h"
 #import "RACEmptySignal.h"
@@ -15,11 +16,13 @@
 #import "RACMulticastConnection.h"
 #import "RACReplaySubject.h"
 #import "RACReturnSignal.h"
-#import "RACScheduler.h"
+#import "RACScheduler+Private.h"
 #import "RACSerialDisposable.h"
 #import "RACSignal+Operations.h"
 #import "RACSubject.h"
 #import "RACSubscriber+Private.h"
+#import "RACSubscriptionScheduler.h"
+#import "RACTrampolineScheduler.h"
 #import "RACTuple.h"
 #import <libkern/OSAtomic.h>
 
@@ -201,21 +204,9 @@
 }
 
 - (RACSignal *)concat:(RACSignal *)signal {
-    return [[RACSignal createSignal:^(id<RACSubscriber> subscriber) {
-        RACCompoundDisposable *compoundDisposable = [[RACCompoundDisposable alloc] init];
-        
-        RACDisposable *sourceDisposable = [self subscribeNext:^(id x) {
-            [subscriber sendNext:x];
-        } error:^(NSError *error) {
-            [subscriber sendError:error];
-        } completed:^{
-            RACDisposable *concattedDisposable = [signal subscribe:subscriber];
-            [compoundDisposable addDisposable:concattedDisposable];
-        }];
-        
-        [compoundDisposable addDisposable:sourceDisposable];
-        return compoundDisposable;
-    }] setNameWithFormat:@"[%@] -concat: %@", self.name, signal];
+    // Concatenating onto a concatenated signal appends to it, rather than
+    // nesting it, so long chains don't forward values through every level.
+    return [[RACConcatSignal signalByConcatenatingSignal:self withSignal:signal] setNameWithFormat:@"[%@] -concat: %@", self.name, signal];
     
     /*
      调用concat之后的signal的didSubscribe, 会先订阅前一个signal，并正常的执行前一个signal的didSubscribe，当前一个signal sendCompleted的时候，就开始订阅后一个signal，然后开始执行后一个signal的didSubscribe, 在concat之前，前后的signal会首先将各自的didSubscribe copy起来，然后在concat之后，新的signal的didSubscribe 再把对应的block copy。
@@ -368,6 +359,34 @@
 
 @end
 
+@implementation RACSignal (SubscriptionPolicy)
+
++ (RACSubscriptionPolicy)defaultSubscriptionPolicy {
+    return ((RACSubscriptionScheduler *)RACScheduler.subscriptionScheduler).defaultPolicy;
+}
+
++ (void)setDefaultSubscriptionPolicy:(RACSubscriptionPolicy)policy {
+    NSCParameterAssert(policy != RACSubscriptionPolicyInherit);
+
+    ((RACSubscriptionScheduler *)RACScheduler.subscriptionScheduler).defaultPolicy = policy;
+}
+
+- (RACSignal *)subscriptionPolicy:(RACSubscriptionPolicy)policy {
+    return [[RACDynamicSignal createSignal:^(id<RACSubscriber> subscriber) {
+        return [self subscribe:subscriber];
+    } subscriptionPolicy:policy] setNameWithFormat:@"[%@] -subscriptionPolicy: %ld", self.name, (long)policy];
+}
+
++ (RACSubscriptionStatistics)subscriptionStatistics {
+    return ((RACSubscriptionScheduler *)RACScheduler.subscriptionScheduler).statistics;
+}
+
++ (void)resetSubscriptionStatistics {
+    [(RACSubscriptionScheduler *)RACScheduler.subscriptionScheduler resetStatistics];
+}
+
+@end
+
 @implementation RACSignal (Debugging)
 
 - (RACSignal *)logAll {
@@ -430,6 +449,14 @@ static const NSTimeInterval RACSignalAsynchronousWaitTimeout = 10;
     }];
     
     do {
+        // Subscriptions may have been deferred behind the trampolined block
+        // this is running in, which the run loop won't execute.
+        [(RACTrampolineScheduler *)RACScheduler.trampolineScheduler drainQueueUntil:^{
+            return done;
+        }];
+
+        if (done) break;
+
         [NSRunLoop.mainRunLoop runMode:NSDefaultRunLoopMode beforeDate:[NSDate dateWithTimeIntervalSinceNow:0.1]];
     } while (!done);
     
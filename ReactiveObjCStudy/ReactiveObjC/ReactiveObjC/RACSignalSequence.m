@@ -7,71 +7,175 @@
 //
 
 #import "RACSignalSequence.h"
-#import "RACDisposable.h"
-#import "RACReplaySubject.h"
-#import "RACSignal+Operations.h"
+#import "RACSignal.h"
+#import <pthread.h>
 
-@interface RACSignalSequence ()
+// Accumulates the values sent by a signal, for every node of a
+// RACSignalSequence to share.
+@interface RACSignalSequenceBuffer : NSObject
+
+// Subscribes to `signal` and begins accumulating its values.
+- (instancetype)initWithSignal:(RACSignal *)signal;
+
+// Blocks until the signal has sent a value at the given index, or has
+// terminated.
+//
+// Returns the value at `index`, with nils represented by NSNulls, or nil if the
+// signal terminated without sending that many values.
+- (id)valueAtIndex:(NSUInteger)index;
 
-// Replays the signal given on initialization.
-@property (nonatomic, strong, readonly) RACReplaySubject *subject;
+// Blocks until the signal has terminated.
+//
+// Returns the values sent from the given index onwards.
+- (NSArray *)valuesFromIndex:(NSUInteger)index;
+
+// Returns the values which have been sent so far from the given index onwards,
+// without blocking.
+- (NSArray *)currentValuesFromIndex:(NSUInteger)index;
 
 @end
 
-@implementation RACSignalSequence
+@implementation RACSignalSequenceBuffer {
+	// Protects everything below.
+	pthread_mutex_t _mutex;
 
-#pragma mark Lifecycle
+	// Broadcast whenever a value is added or the signal terminates.
+	pthread_cond_t _condition;
 
-+ (RACSequence *)sequenceWithSignal:(RACSignal *)signal {
-	RACSignalSequence *seq = [[self alloc] init];
+	// The values sent so far. This only ever grows.
+	NSMutableArray *_values;
+
+	// Whether the signal has completed or errored.
+	BOOL _terminated;
+}
+
+- (instancetype)initWithSignal:(RACSignal *)signal {
+	NSCParameterAssert(signal != nil);
+
+	self = [super init];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	pthread_cond_init(&_condition, NULL);
+
+	_values = [[NSMutableArray alloc] init];
 
-	RACReplaySubject *subject = [RACReplaySubject subject];
 	[signal subscribeNext:^(id value) {
-		[subject sendNext:value];
+		pthread_mutex_lock(&self->_mutex);
+		[self->_values addObject:value ?: NSNull.null];
+		pthread_cond_broadcast(&self->_condition);
+		pthread_mutex_unlock(&self->_mutex);
 	} error:^(NSError *error) {
-		[subject sendError:error];
+		[self terminate];
 	} completed:^{
-		[subject sendCompleted];
+		[self terminate];
 	}];
 
-	seq->_subject = subject;
+	return self;
+}
+
+- (void)dealloc {
+	pthread_cond_destroy(&_condition);
+
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+- (void)terminate {
+	pthread_mutex_lock(&_mutex);
+	_terminated = YES;
+	pthread_cond_broadcast(&_condition);
+	pthread_mutex_unlock(&_mutex);
+}
+
+- (id)valueAtIndex:(NSUInteger)index {
+	pthread_mutex_lock(&_mutex);
+
+	while (_values.count <= index && !_terminated) {
+		pthread_cond_wait(&_condition, &_mutex);
+	}
+
+	id value = (index < _values.count ? _values[index] : nil);
+
+	pthread_mutex_unlock(&_mutex);
+
+	return value;
+}
+
+- (NSArray *)valuesFromIndex:(NSUInteger)index {
+	pthread_mutex_lock(&_mutex);
+
+	while (!_terminated) {
+		pthread_cond_wait(&_condition, &_mutex);
+	}
+
+	pthread_mutex_unlock(&_mutex);
+
+	return [self currentValuesFromIndex:index];
+}
+
+- (NSArray *)currentValuesFromIndex:(NSUInteger)index {
+	pthread_mutex_lock(&_mutex);
+
+	NSArray *values = @[];
+	if (index < _values.count) values = [_values subarrayWithRange:NSMakeRange(index, _values.count - index)];
+
+	pthread_mutex_unlock(&_mutex);
+
+	return values;
+}
+
+@end
+
+@interface RACSignalSequence ()
+
+// The values of the signal given on initialization, shared by every node.
+@property (nonatomic, strong, readonly) RACSignalSequenceBuffer *buffer;
+
+// The index in `buffer` from which the sequence starts.
+@property (nonatomic, assign, readonly) NSUInteger index;
+
+@end
+
+@implementation RACSignalSequence
+
+#pragma mark Lifecycle
+
++ (RACSequence *)sequenceWithSignal:(RACSignal *)signal {
+	return [self sequenceWithBuffer:[[RACSignalSequenceBuffer alloc] initWithSignal:signal] index:0];
+}
+
++ (RACSequence *)sequenceWithBuffer:(RACSignalSequenceBuffer *)buffer index:(NSUInteger)index {
+	RACSignalSequence *seq = [[self alloc] init];
+	seq->_buffer = buffer;
+	seq->_index = index;
 	return seq;
 }
 
 #pragma mark RACSequence
 
 - (id)head {
-	id value = [self.subject firstOrDefault:self];
-
-	if (value == self) {
-		return nil;
-	} else {
-		return value ?: NSNull.null;
-	}
+	return [self.buffer valueAtIndex:self.index];
 }
 
 - (RACSequence *)tail {
-	RACSequence *sequence = [self.class sequenceWithSignal:[self.subject skip:1]];
+	// Each node is only a cursor into the shared buffer, so advancing doesn't
+	// need to resubscribe or replay anything.
+	RACSequence *sequence = [self.class sequenceWithBuffer:self.buffer index:self.index + 1];
 	sequence.name = self.name;
 	return sequence;
 }
 
 - (NSArray *)array {
-	return self.subject.toArray;
+	return [self.buffer valuesFromIndex:self.index];
 }
 
 #pragma mark NSObject
 
 - (NSString *)description {
-	// Synchronously accumulate the values that have been sent so far.
-	NSMutableArray *values = [NSMutableArray array];
-	RACDisposable *disposable = [self.subject subscribeNext:^(id value) {
-		@synchronized (values) {
-			[values addObject:value ?: NSNull.null];
-		}
-	}];
-
-	[disposable dispose];
+	// Only describe the values that have been sent so far.
+	NSArray *values = [self.buffer currentValuesFromIndex:self.index];
 
 	return [NSString stringWithFormat:@"<%@: %p>{ name = %@, values = %@ … }", self.class, self, self.name, values];
 }
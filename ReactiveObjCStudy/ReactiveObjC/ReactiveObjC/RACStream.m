@@ -10,6 +10,7 @@
 #import "NSObject+RACDescription.h"
 #import "RACBlockTrampoline.h"
 #import "RACTuple.h"
+#import "RACTuple+Private.h"
 
 @implementation RACStream
 
@@ -207,10 +208,13 @@
 
 + (__kindof RACStream *)join:(id<NSFastEnumeration>)streams block:(RACStream * (^)(id, id))block {
 	RACStream *current = nil;
+	NSUInteger streamCount = 0;
 
 	// Creates streams of successively larger tuples by combining the input
 	// streams one-by-one.
 	for (RACStream *stream in streams) {
+		streamCount++;
+
 		// For the first stream, just wrap its values in a RACTuple. That way,
 		// if only one stream is given, the result is still a stream of tuples.
 		if (current == nil) {
@@ -232,14 +236,24 @@
 		// (((1), 2), 3)
 		//
 		// We need to unwrap all the layers and create a tuple out of the result.
-		NSMutableArray *values = [[NSMutableArray alloc] init];
-
-		while (xs != nil) {
-			[values insertObject:xs.last ?: RACTupleNil.tupleNil atIndex:0];
+		// The layers keep every value alive, so they can be gathered into
+		// temporary storage, filling it from the end.
+		__unsafe_unretained id stackValues[8];
+		__unsafe_unretained id *values = stackValues;
+		if (streamCount > 8) values = (__unsafe_unretained id *)malloc(streamCount * sizeof(id));
+
+		NSUInteger index = streamCount;
+		while (xs != nil && index > 0) {
+			values[--index] = xs.last ?: RACTupleNil.tupleNil;
 			xs = (xs.count > 1 ? xs.first : nil);
 		}
 
-		return [RACTuple tupleWithObjectsFromArray:values];
+		NSCAssert(index == 0, @"Expected %lu nested tuples", (unsigned long)streamCount);
+
+		RACTuple *tuple = [RACTuple tupleWithObjects:values + index count:streamCount - index];
+		if (values != stackValues) free(values);
+
+		return tuple;
 	}];
 }
 
@@ -0,0 +1,29 @@
+//
+//  RACStreamingSequence.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACSequence.h"
+
+// Private class that implements a single-pass sequence, which doesn't memoize
+// its values.
+//
+// Each value is produced exactly once, and handed to whichever consumer asks
+// for it first, so enumerating the sequence uses a constant amount of memory
+// no matter how long it is. A streaming sequence should only have one consumer.
+//
+// Accessing -head or -tail memoizes the remaining values, as if by
+// -memoizedSequence, since those can be accessed any number of times.
+@interface RACStreamingSequence : RACSequence
+
+// Returns a sequence of the values returned by `generator`, which is invoked
+// once for each value until it returns nil.
++ (RACSequence *)sequenceWithGenerator:(id (^)(void))generator;
+
+// Returns the next value of the sequence, or nil once it's been exhausted.
+- (id)nextObject;
+
+@end
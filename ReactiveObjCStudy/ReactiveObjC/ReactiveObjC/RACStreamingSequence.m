@@ -0,0 +1,212 @@
+//
+//  RACStreamingSequence.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACStreamingSequence.h"
+#import "RACDynamicSequence.h"
+
+// An enumerator which consumes the values of a streaming sequence.
+@interface RACStreamingSequenceEnumerator : NSEnumerator
+
+- (instancetype)initWithSequence:(RACStreamingSequence *)sequence;
+
+@end
+
+@implementation RACStreamingSequenceEnumerator {
+	// The sequence to consume. This is released once it's been exhausted.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	RACStreamingSequence *_sequence;
+}
+
+- (instancetype)initWithSequence:(RACStreamingSequence *)sequence {
+	self = [super init];
+
+	_sequence = sequence;
+
+	return self;
+}
+
+- (id)nextObject {
+	@synchronized (self) {
+		id value = [_sequence nextObject];
+		if (value == nil) _sequence = nil;
+
+		return value;
+	}
+}
+
+@end
+
+@implementation RACStreamingSequence {
+	// Produces the next value, or nil once the sequence is exhausted. This is
+	// set to nil once the sequence is exhausted or memoized.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	id (^_generator)(void);
+
+	// The memoized remainder of the sequence, once -head or -tail has been
+	// accessed.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	RACSequence *_memoizedSequence;
+
+	// The next node of `_memoizedSequence` to be consumed by -nextObject.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	RACSequence *_memoizedCursor;
+
+	// The values handed out by the last call to
+	// -countByEnumeratingWithState:objects:count:, which must stay alive until
+	// the next call.
+	//
+	// This ivar should only be accessed while synchronized on self.
+	NSArray *_enumeratedValues;
+}
+
+#pragma mark Lifecycle
+
++ (RACSequence *)sequenceWithGenerator:(id (^)(void))generator {
+	NSCParameterAssert(generator != nil);
+
+	RACStreamingSequence *seq = [[self alloc] init];
+	seq->_generator = [generator copy];
+	return seq;
+}
+
+// Returns a memoized sequence of the values returned by `generator`.
++ (RACSequence *)memoizedSequenceWithGenerator:(id (^)(void))generator {
+	// Each node only creates the next one after pulling its own value, so the
+	// generator is always invoked in order.
+	return [RACDynamicSequence sequenceWithLazyDependency:^{
+		return generator();
+	} headBlock:^(id value) {
+		return value;
+	} tailBlock:^ RACSequence * (id value) {
+		if (value == nil) return nil;
+
+		return [self memoizedSequenceWithGenerator:generator];
+	}];
+}
+
+#pragma mark Streaming
+
+- (id)nextObject {
+	@synchronized (self) {
+		if (_memoizedCursor != nil) {
+			id value = _memoizedCursor.head;
+			_memoizedCursor = (value != nil ? _memoizedCursor.tail : nil);
+			return value;
+		}
+
+		if (_generator == nil) return nil;
+
+		id value = _generator();
+		if (value == nil) _generator = nil;
+
+		return value;
+	}
+}
+
+- (RACSequence *)memoizedSequence {
+	@synchronized (self) {
+		if (_memoizedSequence == nil) {
+			// Hand the generator over to the memoized sequence, which then
+			// becomes the source of every later value.
+			id (^generator)(void) = _generator ?: ^ id { return nil; };
+			_generator = nil;
+
+			_memoizedSequence = [self.class memoizedSequenceWithGenerator:generator];
+			_memoizedCursor = _memoizedSequence;
+		}
+
+		return _memoizedSequence;
+	}
+}
+
+- (RACSequence *)streamingSequence {
+	return self;
+}
+
+#pragma mark RACSequence
+
+- (id)head {
+	return self.memoizedSequence.head;
+}
+
+- (RACSequence *)tail {
+	return self.memoizedSequence.tail;
+}
+
+- (NSArray *)array {
+	NSMutableArray *array = [NSMutableArray array];
+
+	id value;
+	while ((value = [self nextObject]) != nil) {
+		[array addObject:value];
+	}
+
+	return [array copy];
+}
+
+- (id)foldLeftWithStart:(id)start reduce:(id (^)(id, id))reduce {
+	NSCParameterAssert(reduce != NULL);
+
+	id value;
+	while ((value = [self nextObject]) != nil) {
+		start = reduce(start, value);
+	}
+
+	return start;
+}
+
+- (NSEnumerator *)objectEnumerator {
+	// Consume values, rather than walking -tail, which would memoize them. This
+	// also lets -signalWithScheduler:quantum:timeBudget: stream the receiver.
+	return [[RACStreamingSequenceEnumerator alloc] initWithSequence:self];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id *)stackbuf count:(NSUInteger)len {
+	NSCParameterAssert(len > 0);
+
+	if (state->state == 0) {
+		state->state = 1;
+
+		// Since a sequence doesn't mutate, this just needs to be set to
+		// something non-NULL that won't change.
+		state->mutationsPtr = state->extra;
+	}
+
+	NSMutableArray *values = [NSMutableArray arrayWithCapacity:len];
+	while (values.count < len) {
+		id value = [self nextObject];
+		if (value == nil) break;
+
+		[values addObject:value];
+	}
+
+	// Only the current batch is kept alive, rather than autoreleasing every
+	// value, so that enumeration uses a constant amount of memory.
+	@synchronized (self) {
+		_enumeratedValues = values;
+	}
+
+	[values getObjects:stackbuf range:NSMakeRange(0, values.count)];
+	state->itemsPtr = stackbuf;
+
+	return values.count;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p>{ name = %@ }", self.class, self, self.name];
+}
+
+@end
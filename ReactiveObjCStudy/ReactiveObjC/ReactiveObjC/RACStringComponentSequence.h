@@ -0,0 +1,28 @@
+//
+//  RACStringComponentSequence.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACSequence.h"
+
+// Private class that lazily splits a string into components.
+//
+// Each node finds only its own component, scanning the characters of the
+// string directly, so the string is scanned once in total no matter how many
+// components it has.
+@interface RACStringComponentSequence : RACSequence
+
+// Returns a sequence of the lines in the given string, without their line
+// terminators. A line terminator at the very end of the string doesn't produce
+// an empty last line. The string will be copied to prevent mutation.
++ (RACSequence *)lineSequenceWithString:(NSString *)string;
+
+// Returns a sequence of the runs of characters in the given string which are
+// not in `separators`. Empty runs are skipped. The string will be copied to
+// prevent mutation.
++ (RACSequence *)tokenSequenceWithString:(NSString *)string separators:(NSCharacterSet *)separators;
+
+@end
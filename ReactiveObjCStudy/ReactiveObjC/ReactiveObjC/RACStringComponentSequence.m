@@ -0,0 +1,139 @@
+//
+//  RACStringComponentSequence.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACStringComponentSequence.h"
+
+@interface RACStringComponentSequence ()
+
+// The string being split.
+@property (nonatomic, copy, readonly) NSString *string;
+
+// The index in the string from which the sequence starts.
+@property (nonatomic, assign, readonly) NSUInteger offset;
+
+// The characters which separate tokens, or nil if the string is being split
+// into lines.
+@property (nonatomic, copy, readonly) NSCharacterSet *separators;
+
+@end
+
+@implementation RACStringComponentSequence {
+	// The range of the first component in `string`, and the index from which
+	// to look for the next one, once they've been found.
+	//
+	// These ivars should only be accessed while synchronized on self.
+	NSRange _componentRange;
+	NSUInteger _nextOffset;
+	BOOL _hasFoundComponent;
+}
+
+#pragma mark Lifecycle
+
++ (RACSequence *)lineSequenceWithString:(NSString *)string {
+	return [[self sequenceWithString:[string copy] offset:0 separators:nil] setNameWithFormat:@"-rac_lineSequence"];
+}
+
++ (RACSequence *)tokenSequenceWithString:(NSString *)string separators:(NSCharacterSet *)separators {
+	NSCParameterAssert(separators != nil);
+
+	return [[self sequenceWithString:[string copy] offset:0 separators:separators] setNameWithFormat:@"-rac_tokenSequenceWithSeparators:"];
+}
+
++ (RACSequence *)sequenceWithString:(NSString *)string offset:(NSUInteger)offset separators:(NSCharacterSet *)separators {
+	if (separators != nil) {
+		offset = [self indexOfCharacterInString:string fromIndex:offset inSet:separators matching:NO];
+	}
+
+	if (offset >= string.length) return self.empty;
+
+	RACStringComponentSequence *seq = [[self alloc] init];
+	seq->_string = string;
+	seq->_offset = offset;
+	seq->_separators = separators;
+	return seq;
+}
+
+#pragma mark Scanning
+
+// Returns the index of the first character at or after `index` whose
+// membership of `set` equals `matching`, or the length of the string if
+// there isn't one.
++ (NSUInteger)indexOfCharacterInString:(NSString *)string fromIndex:(NSUInteger)index inSet:(NSCharacterSet *)set matching:(BOOL)matching {
+	CFStringRef cfString = (__bridge CFStringRef)string;
+	CFIndex length = CFStringGetLength(cfString);
+	if ((CFIndex)index >= length) return (NSUInteger)length;
+
+	// Reads the characters in chunks, without allocating, rather than messaging
+	// the string for each one.
+	CFStringInlineBuffer buffer;
+	CFStringInitInlineBuffer(cfString, &buffer, CFRangeMake((CFIndex)index, length - (CFIndex)index));
+
+	for (CFIndex i = 0; i < length - (CFIndex)index; i++) {
+		unichar character = CFStringGetCharacterFromInlineBuffer(&buffer, i);
+		if ([set characterIsMember:character] == matching) return index + (NSUInteger)i;
+	}
+
+	return (NSUInteger)length;
+}
+
+// Finds the first component of the sequence, if it hasn't been found already.
+//
+// This must be invoked while synchronized on self.
+- (void)findComponent {
+	if (_hasFoundComponent) return;
+
+	if (self.separators == nil) {
+		NSUInteger end = 0;
+		NSUInteger contentsEnd = 0;
+		[self.string getLineStart:NULL end:&end contentsEnd:&contentsEnd forRange:NSMakeRange(self.offset, 0)];
+
+		_componentRange = NSMakeRange(self.offset, contentsEnd - self.offset);
+		_nextOffset = end;
+	} else {
+		NSUInteger end = [self.class indexOfCharacterInString:self.string fromIndex:self.offset inSet:self.separators matching:YES];
+
+		_componentRange = NSMakeRange(self.offset, end - self.offset);
+		_nextOffset = end;
+	}
+
+	_hasFoundComponent = YES;
+}
+
+#pragma mark RACSequence
+
+- (id)head {
+	NSRange range;
+
+	@synchronized (self) {
+		[self findComponent];
+		range = _componentRange;
+	}
+
+	return [self.string substringWithRange:range];
+}
+
+- (RACSequence *)tail {
+	NSUInteger nextOffset;
+
+	@synchronized (self) {
+		[self findComponent];
+		nextOffset = _nextOffset;
+	}
+
+	RACSequence *sequence = [self.class sequenceWithString:self.string offset:nextOffset separators:self.separators];
+	sequence.name = self.name;
+	return sequence;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p>{ name = %@, offset = %lu, separators = %@ }", self.class, self, self.name, (unsigned long)self.offset, self.separators];
+}
+
+@end
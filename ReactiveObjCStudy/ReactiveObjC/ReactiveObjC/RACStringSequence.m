@@ -8,6 +8,32 @@
 
 #import "RACStringSequence.h"
 
+// The number of characters, starting from zero, for which shared strings are
+// kept by RACStringWithCharacter().
+static const unichar RACStringSequenceSharedCharacterCount = 256;
+
+// Returns a string containing only the given character.
+//
+// Strings for the most common characters are created once and shared, so that
+// sequencing mostly Latin text doesn't allocate a string per value.
+static NSString *RACStringWithCharacter(unichar character) {
+	static NSArray<NSString *> *sharedStrings = nil;
+	static dispatch_once_t onceToken;
+
+	dispatch_once(&onceToken, ^{
+		NSMutableArray *strings = [NSMutableArray arrayWithCapacity:RACStringSequenceSharedCharacterCount];
+		for (unichar c = 0; c < RACStringSequenceSharedCharacterCount; c++) {
+			[strings addObject:[[NSString alloc] initWithCharacters:&c length:1]];
+		}
+
+		sharedStrings = [strings copy];
+	});
+
+	if (character < RACStringSequenceSharedCharacterCount) return sharedStrings[character];
+
+	return [[NSString alloc] initWithCharacters:&character length:1];
+}
+
 @interface RACStringSequence ()
 
 // The string being sequenced.
@@ -36,7 +62,7 @@
 #pragma mark RACSequence
 
 - (id)head {
-	return [self.string substringWithRange:NSMakeRange(self.offset, 1)];
+	return RACStringWithCharacter([self.string characterAtIndex:self.offset]);
 }
 
 - (RACSequence *)tail {
@@ -56,6 +82,47 @@
 	return [array copy];
 }
 
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id[])stackbuf count:(NSUInteger)len {
+	NSCParameterAssert(len > 0);
+
+	if (state->state == 0) {
+		state->state = 1;
+
+		// The index of the next character to enumerate.
+		state->extra[0] = self.offset;
+
+		// Since a sequence doesn't mutate, this just needs to be set to
+		// something non-NULL that won't change.
+		state->mutationsPtr = &state->extra[1];
+	}
+
+	NSUInteger length = self.string.length;
+	NSUInteger index = state->extra[0];
+	if (index >= length) {
+		// Enumeration has completed.
+		return 0;
+	}
+
+	unichar characters[16];
+	NSRange range = NSMakeRange(index, MIN(MIN(len, 16), length - index));
+	[self.string getCharacters:characters range:range];
+
+	for (NSUInteger i = 0; i < range.length; i++) {
+		// Like -head, each value is a single UTF-16 code unit. Most of these
+		// strings are shared, but autorelease them anyway to keep any others
+		// alive for the enumerator.
+		__autoreleasing NSString *character = RACStringWithCharacter(characters[i]);
+		stackbuf[i] = character;
+	}
+
+	state->itemsPtr = stackbuf;
+	state->extra[0] = NSMaxRange(range);
+
+	return range.length;
+}
+
 #pragma mark NSObject
 
 - (NSString *)description {
@@ -7,6 +7,7 @@
 //
 
 #import "RACScheduler.h"
+#import "RACSignal.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -17,6 +18,35 @@ NS_ASSUME_NONNULL_BEGIN
  */
 @interface RACSubscriptionScheduler : RACScheduler
 
+// The policy for subscriptions which don't specify their own. This will never
+// be RACSubscriptionPolicyInherit.
+@property (atomic, assign) RACSubscriptionPolicy defaultPolicy;
+
+// How the subscriptions scheduled so far have been performed.
+@property (nonatomic, assign, readonly) RACSubscriptionStatistics statistics;
+
+// Resets all of the counters in `statistics` to zero.
+- (void)resetStatistics;
+
+// Schedules the given subscription block.
+//
+// If there is a valid +currentScheduler, the block is executed immediately.
+// Otherwise, `policy` decides whether it is executed on the calling thread or
+// on a private background scheduler.
+//
+// Subscriptions made on the calling thread are trampolined once they nest more
+// than RACTrampolineSubscriptionDepthLimit levels deep, so they may still be
+// deferred until an outer subscription on the same thread has returned.
+// Blocking operators, like -first, execute any such deferred subscriptions
+// while they wait.
+//
+// block  - The block to schedule. Cannot be NULL.
+// policy - The policy to follow when there's no +currentScheduler.
+//
+// Returns a disposable which can be used to cancel the block before it begins
+// executing, or nil if the block was executed inline.
+- (nullable RACDisposable *)schedule:(void (^)(void))block policy:(RACSubscriptionPolicy)policy;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -8,13 +8,28 @@
 
 #import "RACSubscriptionScheduler.h"
 #import "RACScheduler+Private.h"
-
-@interface RACSubscriptionScheduler ()
+#import "RACTrampolineScheduler.h"
+#import <libkern/OSAtomic.h>
+
+// The number of synchronous subscriptions currently executing on this thread.
+// Subscriptions which inherit their policy stay synchronous while this is
+// non-zero, so a synchronous subscription never hops for its inner signals.
+static __thread NSUInteger RACSynchronousSubscriptionDepth = 0;
+
+@interface RACSubscriptionScheduler () {
+	volatile int64_t _immediateCount;
+	volatile int64_t _synchronousCount;
+	volatile int64_t _hoppedCount;
+}
 
 // A private background scheduler on which to subscribe if the +currentScheduler
 // is unknown.
 @property (nonatomic, strong, readonly) RACScheduler *backgroundScheduler;
 
+// Used to run subscriptions synchronously without overflowing the stack when
+// they nest deeply, as with long -concat: chains or recursive -flattenMap:.
+@property (nonatomic, strong, readonly) RACTrampolineScheduler *trampolineScheduler;
+
 @end
 
 @implementation RACSubscriptionScheduler
@@ -25,19 +40,68 @@
 	self = [super initWithName:@"org.reactivecocoa.ReactiveObjC.RACScheduler.subscriptionScheduler"];
 
 	_backgroundScheduler = [RACScheduler scheduler];
+	_trampolineScheduler = (RACTrampolineScheduler *)RACScheduler.trampolineScheduler;
+	_defaultPolicy = RACSubscriptionPolicyBackground;
 
 	return self;
 }
 
-#pragma mark RACScheduler
+#pragma mark Statistics
 
-- (RACDisposable *)schedule:(void (^)(void))block {
+- (RACSubscriptionStatistics)statistics {
+	return (RACSubscriptionStatistics){
+		.immediate = (uint64_t)OSAtomicAdd64Barrier(0, &_immediateCount),
+		.synchronous = (uint64_t)OSAtomicAdd64Barrier(0, &_synchronousCount),
+		.hopped = (uint64_t)OSAtomicAdd64Barrier(0, &_hoppedCount),
+	};
+}
+
+- (void)resetStatistics {
+	OSAtomicAdd64Barrier(-OSAtomicAdd64Barrier(0, &_immediateCount), &_immediateCount);
+	OSAtomicAdd64Barrier(-OSAtomicAdd64Barrier(0, &_synchronousCount), &_synchronousCount);
+	OSAtomicAdd64Barrier(-OSAtomicAdd64Barrier(0, &_hoppedCount), &_hoppedCount);
+}
+
+#pragma mark Scheduling
+
+- (RACDisposable *)schedule:(void (^)(void))block policy:(RACSubscriptionPolicy)policy {
 	NSCParameterAssert(block != NULL);
 
-	if (RACScheduler.currentScheduler == nil) return [self.backgroundScheduler schedule:block];
+	if (RACScheduler.currentScheduler != nil) {
+		OSAtomicIncrement64(&_immediateCount);
 
-	block();
-	return nil;
+		// Run these inline too, but bounce deeply nested ones off the
+		// trampoline, so that long -concat: chains don't overflow the stack.
+		// Blocking operators like -first drain the trampoline while they wait.
+		return [self.trampolineScheduler schedule:block maximumDepth:RACTrampolineSubscriptionDepthLimit];
+	}
+
+	if (policy == RACSubscriptionPolicyInherit) {
+		policy = (RACSynchronousSubscriptionDepth > 0 ? RACSubscriptionPolicySynchronous : self.defaultPolicy);
+	}
+
+	if (policy != RACSubscriptionPolicySynchronous) {
+		OSAtomicIncrement64(&_hoppedCount);
+		return [self.backgroundScheduler schedule:block];
+	}
+
+	OSAtomicIncrement64(&_synchronousCount);
+
+	return [self.trampolineScheduler schedule:^{
+		RACSynchronousSubscriptionDepth++;
+
+		@try {
+			block();
+		} @finally {
+			RACSynchronousSubscriptionDepth--;
+		}
+	} maximumDepth:RACTrampolineSubscriptionDepthLimit];
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	return [self schedule:block policy:RACSubscriptionPolicyInherit];
 }
 
 - (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
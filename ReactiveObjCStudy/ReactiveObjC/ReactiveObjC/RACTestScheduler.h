@@ -8,6 +8,8 @@
 
 #import "RACScheduler.h"
 
+@class RACSignal<__covariant ValueType>;
+
 NS_ASSUME_NONNULL_BEGIN
 
 // A special kind of scheduler that steps through virtualized time.
@@ -15,11 +17,21 @@ NS_ASSUME_NONNULL_BEGIN
 // This scheduler class can be used in unit tests to verify asynchronous
 // behaviors without spending significant time waiting.
 //
+// The scheduler keeps a virtual clock, measured in integer ticks of one
+// nanosecond, which starts at zero. Blocks scheduled with -schedule: are due at
+// the current virtual time, while delays and dates are converted into ticks
+// relative to it. Executing a block advances the clock to the block's due time,
+// so timer-heavy operators observe time passing exactly as they would in real
+// use, just without the waiting.
+//
 // This class can be used from multiple threads, but only one thread can `step`
 // through the enqueued actions at a time. Other threads will wait while the
 // scheduled blocks are being executed.
 @interface RACTestScheduler : RACScheduler
 
+// The current virtual time of the receiver, in nanoseconds.
+@property (nonatomic, assign, readonly) uint64_t currentTime;
+
 // Initializes a new test scheduler.
 - (instancetype)init;
 
@@ -28,7 +40,8 @@ NS_ASSUME_NONNULL_BEGIN
 // This method will block until the scheduled action has completed.
 - (void)step;
 
-// Executes up to the next `ticks` scheduled blocks.
+// Executes up to the next `ticks` scheduled blocks. Blocks which have been
+// disposed are skipped, and don't count towards `ticks`.
 //
 // This method will block until the scheduled actions have completed.
 //
@@ -41,6 +54,74 @@ NS_ASSUME_NONNULL_BEGIN
 // This method will block until the scheduled actions have completed.
 - (void)stepAll;
 
+// Advances the virtual clock by the given number of nanoseconds, executing
+// every block which becomes due in the meantime, in order.
+//
+// This method will block until the scheduled actions have completed.
+- (void)advanceBy:(uint64_t)interval;
+
+// Advances the virtual clock to the given time, executing every block which
+// becomes due in the meantime, in order. If `time` is earlier than
+// `currentTime`, only blocks which are already due are executed.
+//
+// This method will block until the scheduled actions have completed.
+- (void)advanceTo:(uint64_t)time;
+
+// Schedules a series of blocks at regular virtual times, without enqueuing
+// them all up front.
+//
+// Only the next event of the series is ever held by the scheduler, so this can
+// be used to simulate millions of events in constant memory.
+//
+// count   - The number of events to schedule.
+// time    - The virtual time of the first event, in nanoseconds. If this is
+//           earlier than `currentTime`, the first event is due immediately.
+// spacing - The number of nanoseconds between consecutive events.
+// block   - Invoked once for each event, with the index of the event. Cannot be
+//           nil.
+//
+// Returns a disposable which cancels any events which have not yet executed.
+- (RACDisposable *)scheduleEvents:(NSUInteger)count startingAt:(uint64_t)time spacing:(uint64_t)spacing block:(void (^)(NSUInteger index))block;
+
+@end
+
+// The outcome of a call to
+// -[RACTestScheduler simulateEvents:spacing:throughPipeline:].
+//
+// inputCount      - The number of values sent into the pipeline.
+// outputCount     - The number of values sent by the pipeline.
+// completed       - Whether the pipeline completed.
+// failed          - Whether the pipeline sent an error.
+// virtualDuration - The virtual time which elapsed, in nanoseconds.
+// wallDuration    - The real time which the simulation took, in seconds.
+typedef struct {
+	NSUInteger inputCount;
+	NSUInteger outputCount;
+	BOOL completed;
+	BOOL failed;
+	uint64_t virtualDuration;
+	NSTimeInterval wallDuration;
+} RACTestSchedulerSimulation;
+
+@interface RACTestScheduler (LoadSimulation)
+
+// Drives a pipeline with a stream of events in virtual time, then runs the
+// receiver until no more blocks are scheduled.
+//
+// This can be used to exercise or benchmark timer-heavy operators, like
+// -throttle:, -bufferWithTime:onScheduler:, -timeout:onScheduler: and -delay:,
+// with far more events than would be practical in real time.
+//
+// count    - The number of events to send. Each event sends its index, as an
+//            NSNumber, and the input completes after the last one.
+// spacing  - The number of virtual nanoseconds between events.
+// pipeline - Given the input signal and the receiver, returns the signal to
+//            measure. The input delivers its events on the receiver. Cannot be
+//            nil.
+//
+// Returns a summary of the simulation.
+- (RACTestSchedulerSimulation)simulateEvents:(NSUInteger)count spacing:(uint64_t)spacing throughPipeline:(RACSignal * (^)(RACSignal<NSNumber *> *input, RACTestScheduler *scheduler))pipeline;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -10,15 +10,19 @@
 #import "RACEXTScope.h"
 #import "RACCompoundDisposable.h"
 #import "RACDisposable.h"
+#import "RACSerialDisposable.h"
 #import "RACScheduler+Private.h"
+#import "RACSignal.h"
+#import "RACSubject.h"
 
 @interface RACTestSchedulerAction : NSObject
 
-// The date at which the action should be executed.
-//
-// This absolute time will not actually be honored. This date is only used for
-// comparison, to determine which block should be run _next_.
-@property (nonatomic, copy, readonly) NSDate *date;
+// The virtual time at which the action should be executed.
+@property (nonatomic, assign, readonly) uint64_t time;
+
+// The order in which the action was enqueued, used to break ties between
+// actions due at the same time.
+@property (nonatomic, assign, readonly) uint64_t sequenceNumber;
 
 // The scheduled block.
 @property (nonatomic, copy, readonly) void (^block)(void);
@@ -29,14 +33,19 @@
 @property (nonatomic, strong, readonly) RACDisposable *disposable;
 
 // Initializes a new scheduler action.
-- (instancetype)initWithDate:(NSDate *)date block:(void (^)(void))block;
+- (instancetype)initWithTime:(uint64_t)time sequenceNumber:(uint64_t)sequenceNumber block:(void (^)(void))block;
 
 @end
 
 static CFComparisonResult RACCompareScheduledActions(const void *ptr1, const void *ptr2, void *info) {
 	RACTestSchedulerAction *action1 = (__bridge id)ptr1;
 	RACTestSchedulerAction *action2 = (__bridge id)ptr2;
-	return CFDateCompare((__bridge CFDateRef)action1.date, (__bridge CFDateRef)action2.date, NULL);
+
+	if (action1.time < action2.time) return kCFCompareLessThan;
+	if (action1.time > action2.time) return kCFCompareGreaterThan;
+	if (action1.sequenceNumber < action2.sequenceNumber) return kCFCompareLessThan;
+	if (action1.sequenceNumber > action2.sequenceNumber) return kCFCompareGreaterThan;
+	return kCFCompareEqualTo;
 }
 
 static const void *RACRetainScheduledAction(CFAllocatorRef allocator, const void *ptr) {
@@ -57,14 +66,15 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 // This property should only be used while synchronized on self.
 @property (nonatomic, assign, readonly) CFBinaryHeapRef scheduledActions;
 
-// The number of blocks that have been directly enqueued with -schedule: so
-// far.
+// The number of actions that have been enqueued so far.
 //
-// This is used to ensure unique dates when two blocks are enqueued
-// simultaneously.
+// This is used to execute actions due at the same time in the order in which
+// they were enqueued.
 //
 // This property should only be used while synchronized on self.
-@property (nonatomic, assign) NSUInteger numberOfDirectlyScheduledBlocks;
+@property (nonatomic, assign) uint64_t numberOfScheduledActions;
+
+@property (nonatomic, assign, readwrite) uint64_t currentTime;
 
 @end
 
@@ -105,24 +115,7 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 - (void)step:(NSUInteger)ticks {
 	@synchronized (self) {
 		for (NSUInteger i = 0; i < ticks; i++) {
-			const void *actionPtr = NULL;
-			if (!CFBinaryHeapGetMinimumIfPresent(self.scheduledActions, &actionPtr)) break;
-
-			RACTestSchedulerAction *action = (__bridge id)actionPtr;
-			CFBinaryHeapRemoveMinimumValue(self.scheduledActions);
-
-			if (action.disposable.disposed) continue;
-
-			RACScheduler *previousScheduler = RACScheduler.currentScheduler;
-			NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = self;
-
-			action.block();
-
-			if (previousScheduler != nil) {
-				NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = previousScheduler;
-			} else {
-				[NSThread.currentThread.threadDictionary removeObjectForKey:RACSchedulerCurrentSchedulerKey];
-			}
+			if (![self performNextActionDueBy:UINT64_MAX]) break;
 		}
 	}
 }
@@ -131,40 +124,84 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 	[self step:NSUIntegerMax];
 }
 
-#pragma mark RACScheduler
-
-- (RACDisposable *)schedule:(void (^)(void))block {
-	NSCParameterAssert(block != nil);
+- (void)advanceBy:(uint64_t)interval {
+	@synchronized (self) {
+		uint64_t time = self.currentTime + interval;
+		[self advanceTo:(time < interval ? UINT64_MAX : time)];
+	}
+}
 
+- (void)advanceTo:(uint64_t)time {
 	@synchronized (self) {
-		NSDate *uniqueDate = [NSDate dateWithTimeIntervalSinceReferenceDate:self.numberOfDirectlyScheduledBlocks];
-		self.numberOfDirectlyScheduledBlocks++;
+		while ([self performNextActionDueBy:time]) {}
 
-		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithDate:uniqueDate block:block];
-		CFBinaryHeapAddValue(self.scheduledActions, (__bridge void *)action);
+		if (time > self.currentTime) self.currentTime = time;
+	}
+}
 
-		return action.disposable;
+// Removes the next action which hasn't been disposed from the heap, advances
+// the clock to its time, and executes it. Disposed actions ahead of it are
+// discarded without advancing the clock.
+//
+// time - The latest time at which the action may be due.
+//
+// Returns whether an action was due by `time` and executed. This must be
+// invoked while synchronized on self.
+- (BOOL)performNextActionDueBy:(uint64_t)time {
+	RACTestSchedulerAction *action = nil;
+
+	while (action == nil) {
+		const void *actionPtr = NULL;
+		if (!CFBinaryHeapGetMinimumIfPresent(self.scheduledActions, &actionPtr)) return NO;
+
+		RACTestSchedulerAction *nextAction = (__bridge id)actionPtr;
+		if (nextAction.time > time) return NO;
+
+		CFBinaryHeapRemoveMinimumValue(self.scheduledActions);
+		if (!nextAction.disposable.disposed) action = nextAction;
+	}
+
+	if (action.time > self.currentTime) self.currentTime = action.time;
+
+	RACScheduler *previousScheduler = RACScheduler.currentScheduler;
+	NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = self;
+
+	action.block();
+
+	if (previousScheduler != nil) {
+		NSThread.currentThread.threadDictionary[RACSchedulerCurrentSchedulerKey] = previousScheduler;
+	} else {
+		[NSThread.currentThread.threadDictionary removeObjectForKey:RACSchedulerCurrentSchedulerKey];
 	}
+
+	return YES;
 }
 
-- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
-	NSCParameterAssert(date != nil);
-	NSCParameterAssert(block != nil);
+#pragma mark Enqueuing
 
+// Enqueues the given block to execute at a virtual time.
+//
+// Returns the disposable of the enqueued action.
+- (RACDisposable *)enqueueBlock:(void (^)(void))block atTime:(uint64_t)time {
 	@synchronized (self) {
-		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithDate:date block:block];
+		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithTime:MAX(time, self.currentTime) sequenceNumber:self.numberOfScheduledActions++ block:block];
 		CFBinaryHeapAddValue(self.scheduledActions, (__bridge void *)action);
 
 		return action.disposable;
 	}
 }
 
-- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
-	NSCParameterAssert(date != nil);
-	NSCParameterAssert(block != nil);
-	NSCParameterAssert(interval >= 0);
-	NSCParameterAssert(leeway >= 0);
+// Converts a date into a virtual time, by treating the interval between now
+// and `date` as the interval from the current virtual time.
+- (uint64_t)timeWithDate:(NSDate *)date {
+	NSTimeInterval delay = fmax(date.timeIntervalSinceNow, 0);
+
+	@synchronized (self) {
+		return self.currentTime + (uint64_t)fmin(delay * NSEC_PER_SEC, (double)(UINT64_MAX - self.currentTime));
+	}
+}
 
+- (RACDisposable *)scheduleRepeatingBlock:(void (^)(void))block atTime:(uint64_t)time interval:(uint64_t)interval {
 	RACCompoundDisposable *compoundDisposable = [RACCompoundDisposable compoundDisposable];
 
 	@weakify(self);
@@ -177,35 +214,150 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 			[compoundDisposable removeDisposable:thisDisposable];
 
 			// Schedule the next interval.
-			RACDisposable *schedulingDisposable = [self after:[date dateByAddingTimeInterval:interval] repeatingEvery:interval withLeeway:leeway schedule:block];
+			RACDisposable *schedulingDisposable = [self scheduleRepeatingBlock:block atTime:time + interval interval:interval];
 			[compoundDisposable addDisposable:schedulingDisposable];
 
 			block();
 		};
 
-		RACTestSchedulerAction *action = [[RACTestSchedulerAction alloc] initWithDate:date block:reschedulingBlock];
-		CFBinaryHeapAddValue(self.scheduledActions, (__bridge void *)action);
-
-		thisDisposable = action.disposable;
+		thisDisposable = [self enqueueBlock:reschedulingBlock atTime:time];
 		[compoundDisposable addDisposable:thisDisposable];
 	}
 
 	return compoundDisposable;
 }
 
+- (RACDisposable *)scheduleEvents:(NSUInteger)count startingAt:(uint64_t)time spacing:(uint64_t)spacing block:(void (^)(NSUInteger index))block {
+	NSCParameterAssert(block != nil);
+
+	RACSerialDisposable *serialDisposable = [[RACSerialDisposable alloc] init];
+	if (count == 0) return serialDisposable;
+
+	__block NSUInteger index = 0;
+	__block uint64_t nextTime = time;
+
+	@weakify(self);
+	__block __weak void (^weakEventBlock)(void) = nil;
+	void (^eventBlock)(void) = ^{
+		@strongify(self);
+
+		NSUInteger currentIndex = index++;
+
+		// Enqueue the next event first, so that anything the block schedules
+		// for the same time runs before it.
+		if (index < count) {
+			nextTime += spacing;
+			serialDisposable.disposable = [self enqueueBlock:weakEventBlock atTime:nextTime];
+		}
+
+		block(currentIndex);
+	};
+
+	weakEventBlock = eventBlock;
+	serialDisposable.disposable = [self enqueueBlock:eventBlock atTime:time];
+
+	return serialDisposable;
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	NSCParameterAssert(block != nil);
+
+	@synchronized (self) {
+		return [self enqueueBlock:block atTime:self.currentTime];
+	}
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != nil);
+
+	return [self enqueueBlock:block atTime:[self timeWithDate:date]];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay schedule:(void (^)(void))block {
+	NSCParameterAssert(block != nil);
+
+	@synchronized (self) {
+		return [self enqueueBlock:block atTime:self.currentTime + delay];
+	}
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != nil);
+	NSCParameterAssert(interval >= 0);
+	NSCParameterAssert(leeway >= 0);
+
+	return [self scheduleRepeatingBlock:block atTime:[self timeWithDate:date] interval:(uint64_t)(interval * NSEC_PER_SEC)];
+}
+
+- (RACDisposable *)afterNanoseconds:(uint64_t)delay repeatingEveryNanoseconds:(uint64_t)interval withLeewayNanoseconds:(uint64_t)leeway schedule:(void (^)(void))block {
+	NSCParameterAssert(block != nil);
+
+	@synchronized (self) {
+		return [self scheduleRepeatingBlock:block atTime:self.currentTime + delay interval:interval];
+	}
+}
+
+@end
+
+@implementation RACTestScheduler (LoadSimulation)
+
+- (RACTestSchedulerSimulation)simulateEvents:(NSUInteger)count spacing:(uint64_t)spacing throughPipeline:(RACSignal * (^)(RACSignal<NSNumber *> *input, RACTestScheduler *scheduler))pipeline {
+	NSCParameterAssert(pipeline != nil);
+
+	__block RACTestSchedulerSimulation simulation = { .inputCount = 0 };
+
+	RACSubject *input = [RACSubject subject];
+	RACSignal *output = pipeline(input, self);
+	NSCAssert(output != nil, @"Pipeline returned a nil signal");
+
+	RACDisposable *subscription = [output subscribeNext:^(id _) {
+		simulation.outputCount++;
+	} error:^(NSError *error) {
+		simulation.failed = YES;
+	} completed:^{
+		simulation.completed = YES;
+	}];
+
+	CFAbsoluteTime wallStart = CFAbsoluteTimeGetCurrent();
+	uint64_t virtualStart = self.currentTime;
+
+	if (count > 0) {
+		[self scheduleEvents:count startingAt:virtualStart + spacing spacing:spacing block:^(NSUInteger index) {
+			simulation.inputCount++;
+			[input sendNext:@(index)];
+
+			if (index + 1 == count) [input sendCompleted];
+		}];
+	} else {
+		[input sendCompleted];
+	}
+
+	[self stepAll];
+	[subscription dispose];
+
+	simulation.virtualDuration = self.currentTime - virtualStart;
+	simulation.wallDuration = CFAbsoluteTimeGetCurrent() - wallStart;
+
+	return simulation;
+}
+
 @end
 
 @implementation RACTestSchedulerAction
 
 #pragma mark Lifecycle
 
-- (instancetype)initWithDate:(NSDate *)date block:(void (^)(void))block {
-	NSCParameterAssert(date != nil);
+- (instancetype)initWithTime:(uint64_t)time sequenceNumber:(uint64_t)sequenceNumber block:(void (^)(void))block {
 	NSCParameterAssert(block != nil);
 
 	self = [super init];
 
-	_date = [date copy];
+	_time = time;
+	_sequenceNumber = sequenceNumber;
 	_block = [block copy];
 	_disposable = [[RACDisposable alloc] init];
 
@@ -215,7 +367,7 @@ static void RACReleaseScheduledAction(CFAllocatorRef allocator, const void *ptr)
 #pragma mark NSObject
 
 - (NSString *)description {
-	return [NSString stringWithFormat:@"<%@: %p>{ date: %@ }", self.class, self, self.date];
+	return [NSString stringWithFormat:@"<%@: %p>{ time: %llu }", self.class, self, self.time];
 }
 
 @end
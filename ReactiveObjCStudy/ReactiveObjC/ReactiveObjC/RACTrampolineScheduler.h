@@ -0,0 +1,55 @@
+//
+//  RACTrampolineScheduler.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACScheduler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// The number of trampolined blocks which may be nested on one thread before
+// -schedule:maximumDepth: starts queueing work instead of recursing, when used
+// to guard synchronous subscriptions.
+extern const NSUInteger RACTrampolineSubscriptionDepthLimit;
+
+// A private scheduler which executes its scheduled blocks synchronously on the
+// calling thread, without growing the stack.
+//
+// The first block scheduled on a thread is executed immediately. Any blocks
+// scheduled while it is running are appended to a per-thread queue, which is
+// drained iteratively once the outermost block returns. All scheduled work has
+// therefore finished by the time the outermost call to -schedule: returns.
+@interface RACTrampolineScheduler : RACScheduler
+
+// Schedules the given block, executing it inline if fewer than `maximumDepth`
+// trampolined blocks are already running on the current thread.
+//
+// Otherwise, the block is queued and executed once the stack has unwound to
+// the outermost trampolined block. -schedule: is equivalent to invoking this
+// method with a `maximumDepth` of 1.
+//
+// block        - The block to schedule. Cannot be NULL.
+// maximumDepth - The nesting depth at which to stop executing blocks inline.
+//                Must be at least 1.
+//
+// Returns a disposable which can be used to cancel the block if it was queued,
+// or nil if it was executed inline.
+- (nullable RACDisposable *)schedule:(void (^)(void))block maximumDepth:(NSUInteger)maximumDepth;
+
+// Executes the blocks queued on the current thread, oldest first, until
+// `predicate` returns YES or none are left.
+//
+// Blocking operators, like -first, invoke this before they wait, since the work
+// they're waiting for may have been queued behind the trampolined block they're
+// running in, which can't return until they do. This does nothing outside of a
+// trampolined block.
+//
+// predicate - Invoked before each queued block is executed. Cannot be NULL.
+- (void)drainQueueUntil:(BOOL (^)(void))predicate;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,150 @@
+//
+//  RACTrampolineScheduler.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACTrampolineScheduler.h"
+#import "RACDisposable.h"
+#import "RACScheduler+Private.h"
+
+const NSUInteger RACTrampolineSubscriptionDepthLimit = 64;
+
+// The number of trampolined blocks currently executing on this thread.
+static __thread NSUInteger RACTrampolineDepth = 0;
+
+// A retained NSMutableArray of blocks waiting for the outermost trampolined
+// block on this thread to return. Created lazily, so that the common case of no
+// nesting doesn't allocate.
+static __thread CFMutableArrayRef RACTrampolineQueue = NULL;
+
+@implementation RACTrampolineScheduler
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [super initWithName:@"org.reactivecocoa.ReactiveObjC.RACScheduler.trampolineScheduler"];
+}
+
+#pragma mark Trampolining
+
+- (RACDisposable *)schedule:(void (^)(void))block maximumDepth:(NSUInteger)maximumDepth {
+	NSCParameterAssert(block != NULL);
+	NSCParameterAssert(maximumDepth >= 1);
+
+	if (RACTrampolineDepth >= maximumDepth) {
+		if (RACTrampolineQueue == NULL) {
+			RACTrampolineQueue = (__bridge_retained CFMutableArrayRef)[[NSMutableArray alloc] init];
+		}
+
+		RACDisposable *disposable = [[RACDisposable alloc] init];
+		[(__bridge NSMutableArray *)RACTrampolineQueue addObject:^{
+			if (disposable.disposed) return;
+			block();
+		}];
+
+		return disposable;
+	}
+
+	if (RACTrampolineDepth > 0) {
+		RACTrampolineDepth++;
+
+		@try {
+			block();
+		} @finally {
+			RACTrampolineDepth--;
+		}
+
+		return nil;
+	}
+
+	RACTrampolineDepth = 1;
+
+	@try {
+		block();
+
+		// Queued blocks are executed at depth 1, as though each was the
+		// outermost, so that they may nest again before being queued. Anything
+		// they queue in turn goes into a fresh batch, which keeps the order FIFO
+		// and lets each batch be freed once it has run.
+		while (RACTrampolineQueue != NULL) {
+			NSArray *batch = CFBridgingRelease(RACTrampolineQueue);
+			RACTrampolineQueue = NULL;
+
+			for (void (^queuedBlock)(void) in batch) {
+				@autoreleasepool {
+					queuedBlock();
+				}
+			}
+		}
+	} @finally {
+		// If a block threw, anything still queued is left for the next
+		// outermost block on this thread to execute.
+		RACTrampolineDepth = 0;
+	}
+
+	return nil;
+}
+
+- (void)drainQueueUntil:(BOOL (^)(void))predicate {
+	NSCParameterAssert(predicate != NULL);
+
+	if (RACTrampolineDepth == 0) return;
+
+	// The blocks are executed at the current depth, so anything they schedule
+	// is queued in turn rather than recursing.
+	while (RACTrampolineQueue != NULL && !predicate()) {
+		NSMutableArray *queue = (__bridge NSMutableArray *)RACTrampolineQueue;
+		if (queue.count == 0) break;
+
+		void (^queuedBlock)(void) = queue[0];
+		[queue removeObjectAtIndex:0];
+
+		@autoreleasepool {
+			queuedBlock();
+		}
+	}
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	return [self schedule:block maximumDepth:1];
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	NSCParameterAssert(date != nil);
+	NSCParameterAssert(block != NULL);
+
+	return [self schedule:^{
+		[NSThread sleepUntilDate:date];
+		block();
+	}];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	NSCAssert(NO, @"+[RACScheduler trampolineScheduler] does not support %@.", NSStringFromSelector(_cmd));
+	return nil;
+}
+
+- (RACDisposable *)scheduleRecursiveBlock:(RACSchedulerRecursiveBlock)recursiveBlock {
+	RACDisposable *disposable = [[RACDisposable alloc] init];
+	recursiveBlock = [recursiveBlock copy];
+
+	RACDisposable *schedulingDisposable = [self schedule:^{
+		for (__block NSUInteger remaining = 1; remaining > 0 && !disposable.disposed; remaining--) {
+			recursiveBlock(^{
+				remaining++;
+			});
+		}
+	}];
+
+	return [RACDisposable disposableWithBlock:^{
+		[disposable dispose];
+		[schedulingDisposable dispose];
+	}];
+}
+
+@end
@@ -0,0 +1,21 @@
+//
+//  RACTuple+Private.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACTuple.h"
+
+@interface RACTuple ()
+
+// Returns a tuple of the given objects, which must already use RACTupleNil to
+// represent nils. The objects are copied, so `objects` may be temporary
+// storage.
+//
+// Tuples of one to five objects use the fixed-arity class of that size, so
+// that their objects are stored inline.
++ (RACTuple *)tupleWithObjects:(__unsafe_unretained id const *)objects count:(NSUInteger)count;
+
+@end
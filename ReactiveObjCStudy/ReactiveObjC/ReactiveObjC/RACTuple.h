@@ -198,6 +198,21 @@ NS_ASSUME_NONNULL_BEGIN
 //
 // See RACTuplePack() and RACTupleUnpack() instead.
 #define RACTuplePack_(...) \
+    RACTuplePack_method(__VA_ARGS__)(__VA_ARGS__)
+
+// Returns the macro that should be used to create a tuple with the provided
+// variadic arguments to RACTuplePack_(). Tuples of up to five values are packed
+// directly into the storage of a fixed-arity tuple, without an array.
+#define RACTuplePack_method(...) \
+        metamacro_at(20, __VA_ARGS__, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_array, RACTuplePack_inline, RACTuplePack_inline, RACTuplePack_inline, RACTuplePack_inline, RACTuplePack_inline)
+
+#define RACTuplePack_inline(...) \
+    ([RACTuplePack_class_name(__VA_ARGS__) pack:metamacro_foreach(RACTuplePack_argument, :, __VA_ARGS__)])
+
+#define RACTuplePack_argument(INDEX, ARG) \
+    (ARG)
+
+#define RACTuplePack_array(...) \
     ([RACTuplePack_class_name(__VA_ARGS__) tupleWithObjectsFromArray:@[ metamacro_foreach(RACTuplePack_object_or_ractuplenil,, __VA_ARGS__) ]])
 
 #define RACTuplePack_object_or_ractuplenil(INDEX, ARG) \
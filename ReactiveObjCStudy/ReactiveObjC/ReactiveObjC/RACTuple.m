@@ -7,6 +7,7 @@
 //
 
 #import "RACTuple.h"
+#import "RACTuple+Private.h"
 #import "RACEXTKeyPathCoding.h"
 #import "RACTupleSequence.h"
 
@@ -41,48 +42,161 @@
 @end
 
 
-@interface RACTuple ()
+@interface RACTuple () {
+	// The objects in the tuple, with nils represented by RACTupleNil. This
+	// points either to storage inline in a fixed-arity subclass, or to
+	// `_heapObjects`.
+	__unsafe_unretained id *_objects;
 
-- (instancetype)initWithBackingArray:(NSArray *)backingArray NS_DESIGNATED_INITIALIZER;
+	// Storage allocated with calloc() for tuples without inline storage.
+	__strong id *_heapObjects;
+}
+
+// Initializes the receiver with the given objects, which must already use
+// RACTupleNil to represent nils.
+- (instancetype)initWithObjects:(__unsafe_unretained id const *)objects count:(NSUInteger)count NS_DESIGNATED_INITIALIZER;
+
+- (instancetype)initWithBackingArray:(NSArray *)backingArray;
 
+// Returns storage for the given number of objects inline in the receiver, or
+// NULL if the receiver has no inline storage. Fixed-arity subclasses override
+// this to avoid allocating.
+- (__strong id *)inlineObjectsForCount:(NSUInteger)count;
+
+// An array of the objects in the tuple, with nils represented by RACTupleNil.
+// This is created every time it's accessed.
 @property (nonatomic, readonly) NSArray *backingArray;
 
+// Compares the objects of the receiver and `tuple` in order.
+- (BOOL)hasObjectsEqualToTuple:(RACTuple *)tuple;
+
+// Returns a new tuple of the given class, with the objects of the receiver
+// followed by `obj`.
+- (id)tupleOfClass:(Class)tupleClass byAddingObject:(id)obj;
+
+// Returns the class to instantiate for a tuple of `count` objects created by
+// the receiver.
++ (Class)classForTupleWithCount:(NSUInteger)count;
+
 @end
 
+// Mixes the bits of a hash, so that similar hashes (e.g., those of small
+// NSNumbers) combine into well-distributed ones.
+static inline NSUInteger RACTupleMixHash(NSUInteger hash) {
+	uint64_t mixed = hash;
+	mixed ^= mixed >> 33;
+	mixed *= 0xff51afd7ed558ccdULL;
+	mixed ^= mixed >> 33;
+
+	return (NSUInteger)mixed;
+}
 
 @implementation RACTuple
 
 - (instancetype)init {
-	return [self initWithBackingArray:@[]];
+	return [self initWithObjects:NULL count:0];
 }
 
-- (instancetype)initWithBackingArray:(NSArray *)backingArray {
+- (instancetype)initWithObjects:(__unsafe_unretained id const *)objects count:(NSUInteger)count {
 	self = [super init];
-	
-	_backingArray = [backingArray copy];
-	
+
+	__strong id *storage = [self inlineObjectsForCount:count];
+	if (storage == NULL && count > 0) {
+		storage = (__strong id *)calloc(count, sizeof(id));
+		_heapObjects = storage;
+	}
+
+	for (NSUInteger i = 0; i < count; i++) {
+		storage[i] = objects[i];
+	}
+
+	_objects = (__unsafe_unretained id *)storage;
+	_count = count;
+
 	return self;
 }
 
+- (instancetype)initWithBackingArray:(NSArray *)backingArray {
+	NSUInteger count = backingArray.count;
+	if (count == 0) return [self initWithObjects:NULL count:0];
+
+	__unsafe_unretained id *objects = (__unsafe_unretained id *)malloc(count * sizeof(id));
+	[backingArray getObjects:objects range:NSMakeRange(0, count)];
+
+	// The array keeps the objects alive until they've been retained.
+	self = [self initWithObjects:objects count:count];
+	free(objects);
+
+	return self;
+}
+
+- (void)dealloc {
+	if (_heapObjects == NULL) return;
+
+	for (NSUInteger i = 0; i < _count; i++) {
+		_heapObjects[i] = nil;
+	}
+
+	free(_heapObjects);
+}
+
+- (__strong id *)inlineObjectsForCount:(NSUInteger)count {
+	return NULL;
+}
+
+- (NSArray *)backingArray {
+	return [NSArray arrayWithObjects:_objects count:_count];
+}
+
 - (NSString *)description {
 	return [NSString stringWithFormat:@"<%@: %p> %@", self.class, self, self.allObjects];
 }
 
+- (BOOL)hasObjectsEqualToTuple:(RACTuple *)tuple {
+	if (tuple->_count != _count) return NO;
+
+	for (NSUInteger i = 0; i < _count; i++) {
+		id object = _objects[i];
+		id otherObject = tuple->_objects[i];
+
+		if (object != otherObject && ![object isEqual:otherObject]) return NO;
+	}
+
+	return YES;
+}
+
 - (BOOL)isEqual:(RACTuple *)object {
 	if (object == self) return YES;
 	if (![object isKindOfClass:self.class]) return NO;
 	
-	return [self.backingArray isEqual:object.backingArray];
+	return [self hasObjectsEqualToTuple:object];
 }
 
 - (NSUInteger)hash {
-	return self.backingArray.hash;
+	// Unlike an array's hash, which is just its count, this depends on every
+	// object, so tuples make good dictionary keys.
+	NSUInteger hash = _count;
+	for (NSUInteger i = 0; i < _count; i++) {
+		hash = RACTupleMixHash(hash * 31 + [_objects[i] hash]);
+	}
+
+	return hash;
 }
 
 #pragma mark NSFastEnumeration
 
 - (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)len {
-	return [self.backingArray countByEnumeratingWithState:state objects:buffer count:len];
+	// Every object is handed out at once, directly from the tuple's storage.
+	if (state->state != 0) return 0;
+
+	state->state = 1;
+	state->itemsPtr = _objects;
+
+	// Since a tuple doesn't mutate, this just needs to be set to something
+	// non-NULL that won't change.
+	state->mutationsPtr = &state->extra[0];
+
+	return _count;
 }
 
 #pragma mark NSCopying
@@ -95,26 +209,46 @@
 #pragma mark NSCoding
 
 - (instancetype)initWithCoder:(NSCoder *)coder {
-	self = [self init];
-	
-	_backingArray = [coder decodeObjectForKey:@keypath(self.backingArray)];
+	NSArray *backingArray = [coder decodeObjectForKey:@keypath(self.backingArray)];
 
-	return self;
+	return [self initWithBackingArray:backingArray ?: @[]];
 }
 
 - (void)encodeWithCoder:(NSCoder *)coder {
-	if (self.backingArray != nil) [coder encodeObject:self.backingArray forKey:@keypath(self.backingArray)];
+	[coder encodeObject:self.backingArray forKey:@keypath(self.backingArray)];
 }
 
 #pragma mark API
 
+// Generic tuples small enough to fit in a fixed-arity tuple use one, so that
+// their objects are stored inline. Fixed-arity tuples override this to keep
+// their class only for their own count.
++ (Class)classForTupleWithCount:(NSUInteger)count {
+	if (self != RACTuple.class) return self;
+
+	switch (count) {
+		case 1: return RACOneTuple.class;
+		case 2: return RACTwoTuple.class;
+		case 3: return RACThreeTuple.class;
+		case 4: return RACFourTuple.class;
+		case 5: return RACFiveTuple.class;
+		default: return self;
+	}
+}
+
++ (RACTuple *)tupleWithObjects:(__unsafe_unretained id const *)objects count:(NSUInteger)count {
+	return [[[RACTuple classForTupleWithCount:count] alloc] initWithObjects:objects count:count];
+}
+
 + (instancetype)tupleWithObjectsFromArray:(NSArray *)array {
 	return [self tupleWithObjectsFromArray:array convertNullsToNils:NO];
 }
 
 + (instancetype)tupleWithObjectsFromArray:(NSArray *)array convertNullsToNils:(BOOL)convert {
+	Class tupleClass = [self classForTupleWithCount:array.count];
+
 	if (!convert) {
-		return [[self alloc] initWithBackingArray:array];
+		return [[tupleClass alloc] initWithBackingArray:array];
 	}
 
 	NSMutableArray *newArray = [NSMutableArray arrayWithCapacity:array.count];
@@ -122,7 +256,7 @@
 		[newArray addObject:(object == NSNull.null ? RACTupleNil.tupleNil : object)];
 	}
 
-	return [[self alloc] initWithBackingArray:newArray];
+	return [[tupleClass alloc] initWithBackingArray:newArray];
 }
 
 + (instancetype)tupleWithObjects:(id)object, ... {
@@ -149,32 +283,39 @@
 
 	va_end(args);
 
-	return [[self alloc] initWithBackingArray:objects];
+	return [[[self classForTupleWithCount:count] alloc] initWithBackingArray:objects];
 }
 
 - (id)objectAtIndex:(NSUInteger)index {
-	if (index >= self.count) return nil;
+	if (index >= _count) return nil;
 	
-	id object = self.backingArray[index];
+	id object = _objects[index];
 	return (object == RACTupleNil.tupleNil ? nil : object);
 }
 
 - (NSArray *)allObjects {
-	NSMutableArray *newArray = [NSMutableArray arrayWithCapacity:self.backingArray.count];
-	for (id object in self.backingArray) {
+	NSMutableArray *newArray = [NSMutableArray arrayWithCapacity:_count];
+	for (NSUInteger i = 0; i < _count; i++) {
+		id object = _objects[i];
 		[newArray addObject:(object == RACTupleNil.tupleNil ? NSNull.null : object)];
 	}
 	
 	return newArray;
 }
 
-- (instancetype)tupleByAddingObject:(id)obj {
-	NSArray *newArray = [self.backingArray arrayByAddingObject:obj ?: RACTupleNil.tupleNil];
-	return [self.class tupleWithObjectsFromArray:newArray];
+- (id)tupleOfClass:(Class)tupleClass byAddingObject:(id)obj {
+	__unsafe_unretained id *objects = (__unsafe_unretained id *)malloc((_count + 1) * sizeof(id));
+	memcpy(objects, _objects, _count * sizeof(id));
+	objects[_count] = obj ?: RACTupleNil.tupleNil;
+
+	RACTuple *tuple = [[tupleClass alloc] initWithObjects:objects count:_count + 1];
+	free(objects);
+
+	return tuple;
 }
 
-- (NSUInteger)count {
-	return self.backingArray.count;
+- (instancetype)tupleByAddingObject:(id)obj {
+	return [self tupleOfClass:[self.class classForTupleWithCount:_count + 1] byAddingObject:obj];
 }
 
 - (id)first {
@@ -220,71 +361,89 @@
 
 @end
 
-@implementation RACOneTuple
+@implementation RACOneTuple {
+	__strong id _inlineObjects[1];
+}
 
 - (instancetype)init {
-	return [self initWithBackingArray:@[ RACTupleNil.tupleNil ]];
+	__unsafe_unretained id objects[] = { RACTupleNil.tupleNil };
+	return [self initWithObjects:objects count:1];
 }
 
-- (instancetype)initWithBackingArray:(NSArray *)backingArray {
-	NSParameterAssert(backingArray.count == 1);
-	return [super initWithBackingArray:backingArray];
++ (Class)classForTupleWithCount:(NSUInteger)count {
+	return (count == 1 ? self : [RACTuple classForTupleWithCount:count]);
+}
+
+- (__strong id *)inlineObjectsForCount:(NSUInteger)count {
+	// Anything else, such as an archive of the wrong size, falls back to heap
+	// storage rather than overflowing.
+	return (count == 1 ? _inlineObjects : NULL);
 }
 
 - (RACTwoTuple *)tupleByAddingObject:(id)obj {
-	NSArray *newArray = [self.backingArray arrayByAddingObject:obj ?: RACTupleNil.tupleNil];
-	return [RACTwoTuple tupleWithObjectsFromArray:newArray];
+	return [self tupleOfClass:RACTwoTuple.class byAddingObject:obj];
 }
 
 + (instancetype)pack:(id)first {
-	return [self tupleWithObjectsFromArray:@[
+	__unsafe_unretained id objects[] = {
 		first ?: RACTupleNil.tupleNil,
-	]];
+	};
+
+	return [[self alloc] initWithObjects:objects count:1];
 }
 
 - (BOOL)isEqual:(RACTuple *)object {
 	if (object == self) return YES;
 
-	// We consider a RACTuple with an identical backing array as equal.
+	// We consider a RACTuple with identical objects as equal.
 	if (![object isKindOfClass:RACTuple.class]) return NO;
 	
-	return [self.backingArray isEqual:object.backingArray];
+	return [self hasObjectsEqualToTuple:object];
 }
 
 @dynamic first;
 
 @end
 
-@implementation RACTwoTuple
+@implementation RACTwoTuple {
+	__strong id _inlineObjects[2];
+}
 
 - (instancetype)init {
-	return [self initWithBackingArray:@[ RACTupleNil.tupleNil, RACTupleNil.tupleNil ]];
+	__unsafe_unretained id objects[] = { RACTupleNil.tupleNil, RACTupleNil.tupleNil };
+	return [self initWithObjects:objects count:2];
 }
 
-- (instancetype)initWithBackingArray:(NSArray *)backingArray {
-	NSParameterAssert(backingArray.count == 2);
-	return [super initWithBackingArray:backingArray];
++ (Class)classForTupleWithCount:(NSUInteger)count {
+	return (count == 2 ? self : [RACTuple classForTupleWithCount:count]);
+}
+
+- (__strong id *)inlineObjectsForCount:(NSUInteger)count {
+	// Anything else, such as an archive of the wrong size, falls back to heap
+	// storage rather than overflowing.
+	return (count == 2 ? _inlineObjects : NULL);
 }
 
 - (RACThreeTuple *)tupleByAddingObject:(id)obj {
-	NSArray *newArray = [self.backingArray arrayByAddingObject:obj ?: RACTupleNil.tupleNil];
-	return [RACThreeTuple tupleWithObjectsFromArray:newArray];
+	return [self tupleOfClass:RACThreeTuple.class byAddingObject:obj];
 }
 
 + (instancetype)pack:(id)first :(id)second {
-	return [self tupleWithObjectsFromArray:@[
+	__unsafe_unretained id objects[] = {
 		first ?: RACTupleNil.tupleNil,
 		second ?: RACTupleNil.tupleNil,
-	]];
+	};
+
+	return [[self alloc] initWithObjects:objects count:2];
 }
 
 - (BOOL)isEqual:(RACTuple *)object {
 	if (object == self) return YES;
 
-	// We consider a RACTuple with an identical backing array as equal.
+	// We consider a RACTuple with identical objects as equal.
 	if (![object isKindOfClass:RACTuple.class]) return NO;
 	
-	return [self.backingArray isEqual:object.backingArray];
+	return [self hasObjectsEqualToTuple:object];
 }
 
 @dynamic first;
@@ -292,37 +451,46 @@
 
 @end
 
-@implementation RACThreeTuple
+@implementation RACThreeTuple {
+	__strong id _inlineObjects[3];
+}
 
 - (instancetype)init {
-	return [super initWithBackingArray:@[ RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil ]];
+	__unsafe_unretained id objects[] = { RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil };
+	return [self initWithObjects:objects count:3];
 }
 
-- (instancetype)initWithBackingArray:(NSArray *)backingArray {
-	NSParameterAssert(backingArray.count == 3);
-	return [super initWithBackingArray:backingArray];
++ (Class)classForTupleWithCount:(NSUInteger)count {
+	return (count == 3 ? self : [RACTuple classForTupleWithCount:count]);
+}
+
+- (__strong id *)inlineObjectsForCount:(NSUInteger)count {
+	// Anything else, such as an archive of the wrong size, falls back to heap
+	// storage rather than overflowing.
+	return (count == 3 ? _inlineObjects : NULL);
 }
 
 - (RACFourTuple *)tupleByAddingObject:(id)obj {
-	NSArray *newArray = [self.backingArray arrayByAddingObject:obj ?: RACTupleNil.tupleNil];
-	return [RACFourTuple tupleWithObjectsFromArray:newArray];
+	return [self tupleOfClass:RACFourTuple.class byAddingObject:obj];
 }
 
 + (instancetype)pack:(id)first :(id)second :(id)third {
-	return [self tupleWithObjectsFromArray:@[
+	__unsafe_unretained id objects[] = {
 		first ?: RACTupleNil.tupleNil,
 		second ?: RACTupleNil.tupleNil,
 		third ?: RACTupleNil.tupleNil,
-	]];
+	};
+
+	return [[self alloc] initWithObjects:objects count:3];
 }
 
 - (BOOL)isEqual:(RACTuple *)object {
 	if (object == self) return YES;
 
-	// We consider a RACTuple with an identical backing array as equal.
+	// We consider a RACTuple with identical objects as equal.
 	if (![object isKindOfClass:RACTuple.class]) return NO;
 	
-	return [self.backingArray isEqual:object.backingArray];
+	return [self hasObjectsEqualToTuple:object];
 }
 
 @dynamic first;
@@ -331,38 +499,47 @@
 
 @end
 
-@implementation RACFourTuple
+@implementation RACFourTuple {
+	__strong id _inlineObjects[4];
+}
 
 - (instancetype)init {
-	return [self initWithBackingArray:@[ RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil ]];
+	__unsafe_unretained id objects[] = { RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil };
+	return [self initWithObjects:objects count:4];
 }
 
-- (instancetype)initWithBackingArray:(NSArray *)backingArray {
-	NSParameterAssert(backingArray.count == 4);
-	return [super initWithBackingArray:backingArray];
++ (Class)classForTupleWithCount:(NSUInteger)count {
+	return (count == 4 ? self : [RACTuple classForTupleWithCount:count]);
+}
+
+- (__strong id *)inlineObjectsForCount:(NSUInteger)count {
+	// Anything else, such as an archive of the wrong size, falls back to heap
+	// storage rather than overflowing.
+	return (count == 4 ? _inlineObjects : NULL);
 }
 
 - (RACFiveTuple *)tupleByAddingObject:(id)obj {
-	NSArray *newArray = [self.backingArray arrayByAddingObject:obj ?: RACTupleNil.tupleNil];
-	return [RACFiveTuple tupleWithObjectsFromArray:newArray];
+	return [self tupleOfClass:RACFiveTuple.class byAddingObject:obj];
 }
 
 + (instancetype)pack:(id)first :(id)second :(id)third :(id)fourth {
-	return [self tupleWithObjectsFromArray:@[
+	__unsafe_unretained id objects[] = {
 		first ?: RACTupleNil.tupleNil,
 		second ?: RACTupleNil.tupleNil,
 		third ?: RACTupleNil.tupleNil,
 		fourth ?: RACTupleNil.tupleNil,
-	]];
+	};
+
+	return [[self alloc] initWithObjects:objects count:4];
 }
 
 - (BOOL)isEqual:(RACTuple *)object {
 	if (object == self) return YES;
 
-	// We consider a RACTuple with an identical backing array as equal.
+	// We consider a RACTuple with identical objects as equal.
 	if (![object isKindOfClass:RACTuple.class]) return NO;
 	
-	return [self.backingArray isEqual:object.backingArray];
+	return [self hasObjectsEqualToTuple:object];
 }
 
 @dynamic first;
@@ -372,34 +549,44 @@
 
 @end
 
-@implementation RACFiveTuple
+@implementation RACFiveTuple {
+	__strong id _inlineObjects[5];
+}
 
 - (instancetype)init {
-	return [self initWithBackingArray:@[ RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil ]];
+	__unsafe_unretained id objects[] = { RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil, RACTupleNil.tupleNil };
+	return [self initWithObjects:objects count:5];
 }
 
-- (instancetype)initWithBackingArray:(NSArray *)backingArray {
-	NSParameterAssert(backingArray.count == 5);
-	return [super initWithBackingArray:backingArray];
++ (Class)classForTupleWithCount:(NSUInteger)count {
+	return (count == 5 ? self : [RACTuple classForTupleWithCount:count]);
+}
+
+- (__strong id *)inlineObjectsForCount:(NSUInteger)count {
+	// Anything else, such as an archive of the wrong size, falls back to heap
+	// storage rather than overflowing.
+	return (count == 5 ? _inlineObjects : NULL);
 }
 
 + (instancetype)pack:(id)first :(id)second :(id)third :(id)fourth :(id)fifth {
-	return [self tupleWithObjectsFromArray:@[
+	__unsafe_unretained id objects[] = {
 		first ?: RACTupleNil.tupleNil,
 		second ?: RACTupleNil.tupleNil,
 		third ?: RACTupleNil.tupleNil,
 		fourth ?: RACTupleNil.tupleNil,
 		fifth ?: RACTupleNil.tupleNil,
-	]];
+	};
+
+	return [[self alloc] initWithObjects:objects count:5];
 }
 
 - (BOOL)isEqual:(RACTuple *)object {
 	if (object == self) return YES;
 
-	// We consider a RACTuple with an identical backing array as equal.
+	// We consider a RACTuple with identical objects as equal.
 	if (![object isKindOfClass:RACTuple.class]) return NO;
 	
-	return [self.backingArray isEqual:object.backingArray];
+	return [self hasObjectsEqualToTuple:object];
 }
 
 @dynamic first;
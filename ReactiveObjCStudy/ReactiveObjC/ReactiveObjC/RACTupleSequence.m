@@ -49,14 +49,55 @@
 
 - (NSArray *)array {
 	NSRange range = NSMakeRange(self.offset, self.tupleBackingArray.count - self.offset);
-	NSMutableArray *array = [[NSMutableArray alloc] initWithCapacity:range.length];
+	NSArray *array = [self.tupleBackingArray subarrayWithRange:range];
 
-	[self.tupleBackingArray enumerateObjectsAtIndexes:[NSIndexSet indexSetWithIndexesInRange:range] options:0 usingBlock:^(id object, NSUInteger index, BOOL *stop) {
-		id mappedObject = (object == RACTupleNil.tupleNil ? NSNull.null : object);
-		[array addObject:mappedObject];
-	}];
+	// Only pay for replacing nils if there are any.
+	if ([array indexOfObjectIdenticalTo:RACTupleNil.tupleNil] == NSNotFound) return array;
 
-	return array;
+	NSMutableArray *mappedArray = [array mutableCopy];
+	for (NSUInteger i = 0; i < mappedArray.count; i++) {
+		if (mappedArray[i] == RACTupleNil.tupleNil) mappedArray[i] = NSNull.null;
+	}
+
+	return [mappedArray copy];
+}
+
+#pragma mark NSFastEnumeration
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(__unsafe_unretained id[])stackbuf count:(NSUInteger)len {
+	NSCParameterAssert(len > 0);
+
+	if (state->state == 0) {
+		state->state = 1;
+
+		// The index of the next value to enumerate.
+		state->extra[0] = self.offset;
+
+		// Since a sequence doesn't mutate, this just needs to be set to
+		// something non-NULL that won't change.
+		state->mutationsPtr = &state->extra[1];
+	}
+
+	NSUInteger count = self.tupleBackingArray.count;
+	NSUInteger index = state->extra[0];
+	if (index >= count) {
+		// Enumeration has completed.
+		return 0;
+	}
+
+	NSRange range = NSMakeRange(index, MIN(len, count - index));
+	[self.tupleBackingArray getObjects:stackbuf range:range];
+
+	// Both the tuple's values and NSNull are kept alive elsewhere, so it's
+	// safe to hand them out unretained.
+	for (NSUInteger i = 0; i < range.length; i++) {
+		if (stackbuf[i] == RACTupleNil.tupleNil) stackbuf[i] = NSNull.null;
+	}
+
+	state->itemsPtr = stackbuf;
+	state->extra[0] = NSMaxRange(range);
+
+	return range.length;
 }
 
 #pragma mark NSObject
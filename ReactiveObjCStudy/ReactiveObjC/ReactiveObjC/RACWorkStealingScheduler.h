@@ -0,0 +1,53 @@
+//
+//  RACWorkStealingScheduler.h
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACScheduler.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+// A serial scheduler which executes its blocks on a fixed pool of worker
+// threads, instead of on a GCD global queue.
+//
+// Each worker thread owns a double-ended queue of schedulers with pending work.
+// Schedulers which become ready on a worker are pushed onto that worker's own
+// queue, and idle workers steal from the other end of their peers' queues. This
+// keeps related work on one thread where possible, while still spreading load
+// across every worker.
+//
+// Like all RACSchedulers, each instance is serial. To run work in parallel,
+// create several schedulers on the same pool with -schedulerWithName:, and
+// target them with -subscribeOn: or -deliverOn:.
+//
+// Worker threads are never torn down, so a pool should be created once and
+// kept for the life of the process.
+@interface RACWorkStealingScheduler : RACScheduler
+
+// The number of worker threads in the receiver's pool.
+@property (nonatomic, assign, readonly) NSUInteger workerCount;
+
+// Initializes the receiver with a new pool of worker threads.
+//
+// name        - The name of the scheduler, also used to name the worker
+//               threads. If nil, a default name will be used.
+// workerCount - The number of worker threads to start. If zero, one worker is
+//               started for each active processor.
+//
+// Returns the initialized object.
+- (instancetype)initWithName:(nullable NSString *)name workerCount:(NSUInteger)workerCount;
+
+// Returns a new serial scheduler which shares the receiver's worker threads.
+//
+// Blocks scheduled on different schedulers from the same pool may execute in
+// parallel.
+//
+// name - The name of the scheduler. If nil, a default name will be used.
+- (RACWorkStealingScheduler *)schedulerWithName:(nullable NSString *)name;
+
+@end
+
+NS_ASSUME_NONNULL_END
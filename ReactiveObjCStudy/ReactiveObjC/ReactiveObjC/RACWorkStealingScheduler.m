@@ -0,0 +1,351 @@
+//
+//  RACWorkStealingScheduler.m
+//  ReactiveObjC
+//
+//  Created by agent on 10/18/26.
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "RACWorkStealingScheduler.h"
+#import "RACScheduler+Private.h"
+#import "RACScheduler+Subclass.h"
+#import <libkern/OSAtomic.h>
+#import <pthread.h>
+
+// The maximum number of blocks a worker executes from one scheduler before
+// giving other schedulers a turn.
+static const NSUInteger RACWorkStealingSchedulerBatchSize = 64;
+
+@class RACWorkStealingPool;
+
+// The worker executing on the current thread, or NULL if the current thread is
+// not a worker. Unretained, since workers live as long as their pool.
+static __thread void *RACCurrentWorker = NULL;
+
+@interface RACWorkStealingScheduler ()
+
+@property (nonatomic, strong, readonly) RACWorkStealingPool *pool;
+
+- (instancetype)initWithName:(NSString *)name pool:(RACWorkStealingPool *)pool;
+
+// Executes up to RACWorkStealingSchedulerBatchSize pending blocks, then hands
+// the receiver back to the pool if any remain.
+//
+// This must only be invoked by a worker thread.
+- (void)drain;
+
+@end
+
+// A worker thread, along with its deque of schedulers awaiting execution.
+@interface RACWorkStealingWorker : NSObject {
+@public
+	// Protects _deque.
+	pthread_mutex_t _mutex;
+
+	// Schedulers awaiting execution. The owning worker pushes and pops at the
+	// end, while other workers steal from the start.
+	NSMutableArray<RACWorkStealingScheduler *> *_deque;
+
+	// The pool which owns this worker. Unretained, since the pool always
+	// outlives its workers.
+	__unsafe_unretained RACWorkStealingPool *_pool;
+
+	// The index of this worker in its pool.
+	NSUInteger _index;
+}
+
+- (void)pushBack:(RACWorkStealingScheduler *)scheduler;
+- (void)pushFront:(RACWorkStealingScheduler *)scheduler;
+- (RACWorkStealingScheduler *)popBack;
+- (RACWorkStealingScheduler *)stealFront;
+
+@end
+
+@interface RACWorkStealingPool : NSObject
+
+@property (nonatomic, assign, readonly) NSUInteger workerCount;
+
+// A serial queue used to fire timers, which then enqueue their blocks on the
+// appropriate scheduler.
+@property (nonatomic, strong, readonly) dispatch_queue_t timerQueue;
+
+- (instancetype)initWithName:(NSString *)name workerCount:(NSUInteger)workerCount;
+
+// Makes the given scheduler available to the workers.
+//
+// scheduler - The scheduler which has blocks pending.
+// yielding  - Whether the scheduler is being handed back after a full batch,
+//             in which case it is queued behind the current worker's other
+//             work rather than ahead of it.
+- (void)submitScheduler:(RACWorkStealingScheduler *)scheduler yielding:(BOOL)yielding;
+
+@end
+
+@implementation RACWorkStealingWorker
+
+- (instancetype)init {
+	self = [super init];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	_deque = [[NSMutableArray alloc] init];
+
+	return self;
+}
+
+- (void)dealloc {
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+- (void)pushBack:(RACWorkStealingScheduler *)scheduler {
+	pthread_mutex_lock(&_mutex);
+	[_deque addObject:scheduler];
+	pthread_mutex_unlock(&_mutex);
+}
+
+- (void)pushFront:(RACWorkStealingScheduler *)scheduler {
+	pthread_mutex_lock(&_mutex);
+	[_deque insertObject:scheduler atIndex:0];
+	pthread_mutex_unlock(&_mutex);
+}
+
+- (RACWorkStealingScheduler *)popBack {
+	pthread_mutex_lock(&_mutex);
+	RACWorkStealingScheduler *scheduler = _deque.lastObject;
+	if (scheduler != nil) [_deque removeLastObject];
+	pthread_mutex_unlock(&_mutex);
+
+	return scheduler;
+}
+
+- (RACWorkStealingScheduler *)stealFront {
+	// Don't contend with the owner or another thief.
+	if (pthread_mutex_trylock(&_mutex) != 0) return nil;
+
+	RACWorkStealingScheduler *scheduler = _deque.firstObject;
+	if (scheduler != nil) [_deque removeObjectAtIndex:0];
+	pthread_mutex_unlock(&_mutex);
+
+	return scheduler;
+}
+
+@end
+
+@implementation RACWorkStealingPool {
+	NSArray<RACWorkStealingWorker *> *_workers;
+
+	// Used to distribute schedulers submitted from outside the pool.
+	volatile int32_t _nextWorkerIndex;
+
+	// The number of schedulers sitting in any worker's deque.
+	volatile int32_t _pendingCount;
+
+	// The number of workers waiting on _idleCondition.
+	volatile int32_t _idleCount;
+
+	pthread_mutex_t _idleMutex;
+	pthread_cond_t _idleCondition;
+}
+
+- (instancetype)initWithName:(NSString *)name workerCount:(NSUInteger)workerCount {
+	NSCParameterAssert(name != nil);
+	NSCParameterAssert(workerCount > 0);
+
+	self = [super init];
+
+	pthread_mutex_init(&_idleMutex, NULL);
+	pthread_cond_init(&_idleCondition, NULL);
+
+	_workerCount = workerCount;
+	_timerQueue = dispatch_queue_create([name stringByAppendingString:@".timers"].UTF8String, DISPATCH_QUEUE_SERIAL);
+
+	NSMutableArray *workers = [NSMutableArray arrayWithCapacity:workerCount];
+	for (NSUInteger i = 0; i < workerCount; i++) {
+		RACWorkStealingWorker *worker = [[RACWorkStealingWorker alloc] init];
+		worker->_pool = self;
+		worker->_index = i;
+		[workers addObject:worker];
+	}
+
+	_workers = [workers copy];
+
+	for (RACWorkStealingWorker *worker in _workers) {
+		NSThread *thread = [[NSThread alloc] initWithBlock:^{
+			[self runWorker:worker];
+		}];
+
+		thread.name = [NSString stringWithFormat:@"%@.worker-%lu", name, (unsigned long)worker->_index];
+		[thread start];
+	}
+
+	return self;
+}
+
+- (void)submitScheduler:(RACWorkStealingScheduler *)scheduler yielding:(BOOL)yielding {
+	RACWorkStealingWorker *worker = (__bridge RACWorkStealingWorker *)RACCurrentWorker;
+
+	if (worker != nil && worker->_pool == self) {
+		if (yielding) {
+			[worker pushFront:scheduler];
+		} else {
+			[worker pushBack:scheduler];
+		}
+	} else {
+		uint32_t index = (uint32_t)OSAtomicIncrement32(&_nextWorkerIndex);
+		[_workers[index % _workerCount] pushBack:scheduler];
+	}
+
+	OSAtomicIncrement32Barrier(&_pendingCount);
+
+	if (OSAtomicAdd32Barrier(0, &_idleCount) > 0) {
+		pthread_mutex_lock(&_idleMutex);
+		pthread_cond_signal(&_idleCondition);
+		pthread_mutex_unlock(&_idleMutex);
+	}
+}
+
+- (RACWorkStealingScheduler *)nextSchedulerForWorker:(RACWorkStealingWorker *)worker {
+	RACWorkStealingScheduler *scheduler = [worker popBack];
+
+	for (NSUInteger i = 1; scheduler == nil && i < _workerCount; i++) {
+		scheduler = [_workers[(worker->_index + i) % _workerCount] stealFront];
+	}
+
+	if (scheduler != nil) OSAtomicDecrement32Barrier(&_pendingCount);
+	return scheduler;
+}
+
+- (void)runWorker:(RACWorkStealingWorker *)worker {
+	RACCurrentWorker = (__bridge void *)worker;
+
+	while (YES) {
+		@autoreleasepool {
+			RACWorkStealingScheduler *scheduler = [self nextSchedulerForWorker:worker];
+			if (scheduler != nil) {
+				[scheduler drain];
+				continue;
+			}
+
+			pthread_mutex_lock(&_idleMutex);
+			OSAtomicIncrement32Barrier(&_idleCount);
+
+			// A steal may have failed because of contention, so only sleep if
+			// nothing is pending anywhere in the pool.
+			while (OSAtomicAdd32Barrier(0, &_pendingCount) <= 0) {
+				pthread_cond_wait(&_idleCondition, &_idleMutex);
+			}
+
+			OSAtomicDecrement32Barrier(&_idleCount);
+			pthread_mutex_unlock(&_idleMutex);
+		}
+	}
+}
+
+@end
+
+@implementation RACWorkStealingScheduler {
+	// Protects _queue and _submitted.
+	pthread_mutex_t _mutex;
+
+	// Blocks waiting to be executed, in order.
+	NSMutableArray *_queue;
+
+	// Whether the receiver is sitting in a worker's deque or being drained.
+	BOOL _submitted;
+}
+
+#pragma mark Lifecycle
+
+- (instancetype)initWithName:(NSString *)name workerCount:(NSUInteger)workerCount {
+	if (name == nil) name = @"org.reactivecocoa.ReactiveObjC.RACWorkStealingScheduler";
+	if (workerCount == 0) workerCount = NSProcessInfo.processInfo.activeProcessorCount;
+
+	RACWorkStealingPool *pool = [[RACWorkStealingPool alloc] initWithName:name workerCount:workerCount];
+	return [self initWithName:name pool:pool];
+}
+
+- (instancetype)initWithName:(NSString *)name pool:(RACWorkStealingPool *)pool {
+	NSCParameterAssert(pool != nil);
+
+	self = [super initWithName:name];
+
+	const int result __attribute__((unused)) = pthread_mutex_init(&_mutex, NULL);
+	NSCAssert(0 == result, @"Failed to initialize mutex with error %d", result);
+
+	_pool = pool;
+	_queue = [[NSMutableArray alloc] init];
+
+	return self;
+}
+
+- (void)dealloc {
+	const int result __attribute__((unused)) = pthread_mutex_destroy(&_mutex);
+	NSCAssert(0 == result, @"Failed to destroy mutex with error %d", result);
+}
+
+- (RACWorkStealingScheduler *)schedulerWithName:(NSString *)name {
+	return [[self.class alloc] initWithName:name pool:self.pool];
+}
+
+#pragma mark Properties
+
+- (NSUInteger)workerCount {
+	return self.pool.workerCount;
+}
+
+#pragma mark Execution
+
+- (void)enqueue:(void (^)(void))block {
+	pthread_mutex_lock(&_mutex);
+	[_queue addObject:[block copy]];
+
+	BOOL shouldSubmit = !_submitted;
+	_submitted = YES;
+	pthread_mutex_unlock(&_mutex);
+
+	if (shouldSubmit) [self.pool submitScheduler:self yielding:NO];
+}
+
+- (void)drain {
+	for (NSUInteger i = 0; i < RACWorkStealingSchedulerBatchSize; i++) {
+		pthread_mutex_lock(&_mutex);
+
+		void (^block)(void) = _queue.firstObject;
+		if (block == nil) {
+			_submitted = NO;
+			pthread_mutex_unlock(&_mutex);
+			return;
+		}
+
+		[_queue removeObjectAtIndex:0];
+		pthread_mutex_unlock(&_mutex);
+
+		[self performAsCurrentScheduler:block];
+	}
+
+	[self.pool submitScheduler:self yielding:YES];
+}
+
+#pragma mark RACScheduler
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+	return [self schedule:block enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock];
+	}];
+}
+
+- (RACDisposable *)after:(NSDate *)date schedule:(void (^)(void))block {
+	return [self after:date schedule:block timerQueue:self.pool.timerQueue enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock];
+	}];
+}
+
+- (RACDisposable *)after:(NSDate *)date repeatingEvery:(NSTimeInterval)interval withLeeway:(NSTimeInterval)leeway schedule:(void (^)(void))block {
+	return [self after:date repeatingEvery:interval withLeeway:leeway schedule:block timerQueue:self.pool.timerQueue enqueue:^(void (^enqueuedBlock)(void)) {
+		[self enqueue:enqueuedBlock];
+	}];
+}
+
+@end
@@ -39,9 +39,12 @@ FOUNDATION_EXPORT const unsigned char ReactiveObjCVersionString[];
 #import "RACDelegateProxy.h"
 #import "RACDisposable.h"
 #import "RACEvent.h"
+#import "RACEventLoopScheduler.h"
+#import "RACFrameBudgetScheduler.h"
 #import "RACGroupedSignal.h"
 #import "RACKVOChannel.h"
 #import "RACMulticastConnection.h"
+#import "RACPriorityScheduler.h"
 #import "RACQueueScheduler.h"
 #import "RACQueueScheduler+Subclass.h"
 #import "RACReplaySubject.h"
@@ -50,6 +53,7 @@ FOUNDATION_EXPORT const unsigned char ReactiveObjCVersionString[];
 #import "RACScopedDisposable.h"
 #import "RACSequence.h"
 #import "RACSerialDisposable.h"
+#import "RACShardedScheduler.h"
 #import "RACSignal+Operations.h"
 #import "RACSignal.h"
 #import "RACStream.h"
@@ -60,6 +64,7 @@ FOUNDATION_EXPORT const unsigned char ReactiveObjCVersionString[];
 #import "RACTestScheduler.h"
 #import "RACTuple.h"
 #import "RACUnit.h"
+#import "RACWorkStealingScheduler.h"
 
 #if TARGET_OS_WATCH
 #elif TARGET_OS_IOS || TARGET_OS_TV
@@ -0,0 +1,213 @@
+//
+//  RACBlockTrampolineTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "RACBlockTrampoline.h"
+
+// Invokes blocks of three arguments through NSInvocation, the way
+// RACBlockTrampoline used to, as a baseline for its performance.
+@interface RACBlockTrampolineTestsInvocation : NSObject
+
+@property (nonatomic, copy, readonly) id block;
+
+- (instancetype)initWithBlock:(id)block;
+
+- (id)invokeWithArguments:(RACTuple *)arguments;
+
+@end
+
+@implementation RACBlockTrampolineTestsInvocation
+
+- (instancetype)initWithBlock:(id)block {
+    self = [super init];
+
+    _block = [block copy];
+
+    return self;
+}
+
+- (id)invokeWithArguments:(RACTuple *)arguments {
+    SEL selector = @selector(performWith:::);
+    NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[self methodSignatureForSelector:selector]];
+    invocation.selector = selector;
+    invocation.target = self;
+
+    for (NSUInteger i = 0; i < arguments.count; i++) {
+        id arg = arguments[i];
+        [invocation setArgument:&arg atIndex:(NSInteger)(i + 2)];
+    }
+
+    [invocation invoke];
+
+    __unsafe_unretained id returnVal;
+    [invocation getReturnValue:&returnVal];
+    return returnVal;
+}
+
+- (id)performWith:(id)obj1 :(id)obj2 :(id)obj3 {
+    id (^block)(id, id, id) = self.block;
+    return block(obj1, obj2, obj3);
+}
+
+@end
+
+@interface RACBlockTrampolineTests : XCTestCase
+
+@end
+
+@implementation RACBlockTrampolineTests
+
+- (void)testEveryArity {
+    // Each block formats its arguments in order.
+    NSArray *blocks = @[
+        ^(id x0) {
+            return [NSString stringWithFormat:@"%@", x0];
+        },
+        ^(id x0, id x1) {
+            return [NSString stringWithFormat:@"%@%@", x0, x1];
+        },
+        ^(id x0, id x1, id x2) {
+            return [NSString stringWithFormat:@"%@%@%@", x0, x1, x2];
+        },
+        ^(id x0, id x1, id x2, id x3) {
+            return [NSString stringWithFormat:@"%@%@%@%@", x0, x1, x2, x3];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@", x0, x1, x2, x3, x4];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7, id x8) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7, x8];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7, id x8, id x9) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7, x8, x9];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7, id x8, id x9, id x10) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7, id x8, id x9, id x10, id x11) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7, id x8, id x9, id x10, id x11, id x12) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7, id x8, id x9, id x10, id x11, id x12, id x13) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13];
+        },
+        ^(id x0, id x1, id x2, id x3, id x4, id x5, id x6, id x7, id x8, id x9, id x10, id x11, id x12, id x13, id x14) {
+            return [NSString stringWithFormat:@"%@%@%@%@%@%@%@%@%@%@%@%@%@%@%@", x0, x1, x2, x3, x4, x5, x6, x7, x8, x9, x10, x11, x12, x13, x14];
+        },
+    ];
+
+    NSMutableArray *arguments = [NSMutableArray array];
+    NSMutableString *expected = [NSMutableString string];
+
+    for (NSUInteger count = 1; count <= 15; count++) {
+        [arguments addObject:[NSString stringWithFormat:@"%c", (char)('a' + count - 1)]];
+        [expected appendString:arguments.lastObject];
+
+        id result = [RACBlockTrampoline invokeBlock:blocks[count - 1] withArguments:[RACTuple tupleWithObjectsFromArray:arguments]];
+        XCTAssertEqualObjects(result, expected);
+    }
+}
+
+- (void)testNilArguments {
+    id result = [RACBlockTrampoline invokeBlock:^(id first, id second, id third) {
+        XCTAssertNil(first);
+        XCTAssertNil(third);
+
+        return second;
+    } withArguments:RACTuplePack(nil, @2, nil)];
+
+    XCTAssertEqualObjects(result, @2);
+}
+
+- (void)testReturningNil {
+    id result = [RACBlockTrampoline invokeBlock:^ id (id first, id second) {
+        return nil;
+    } withArguments:RACTuplePack(@1, @2)];
+
+    XCTAssertNil(result);
+}
+
+- (void)testReduceEach {
+    RACSignal *signal = [[RACSignal return:RACTuplePack(@1, @2, @3)] reduceEach:^(NSNumber *first, NSNumber *second, NSNumber *third) {
+        return @(first.integerValue + second.integerValue + third.integerValue);
+    }];
+
+    XCTAssertEqualObjects([signal first], @6);
+}
+
+- (void)testCombineLatestAndZipReduce {
+    NSArray *signals = @[ [RACSignal return:@"a"], [RACSignal return:@"b"], [RACSignal return:nil], [RACSignal return:@"d"], [RACSignal return:@"e"], [RACSignal return:@"f"] ];
+
+    id (^reduce)(id, id, id, id, id, id) = ^(id a, id b, id c, id d, id e, id f) {
+        return [NSString stringWithFormat:@"%@%@%@%@%@%@", a, b, c, d, e, f];
+    };
+
+    XCTAssertEqualObjects([[RACSignal combineLatest:signals reduce:reduce] first], @"ab(null)def");
+    XCTAssertEqualObjects([[RACSignal zip:signals reduce:reduce] first], @"ab(null)def");
+}
+
+#pragma mark Performance
+
+- (void)testInvokingBlocksPerformance {
+    RACTuple *arguments = RACTuplePack(@1, @2, @3);
+    id block = ^(NSNumber *first, NSNumber *second, NSNumber *third) {
+        return third;
+    };
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 1000000; i++) {
+            @autoreleasepool {
+                [RACBlockTrampoline invokeBlock:block withArguments:arguments];
+            }
+        }
+    }];
+}
+
+- (void)testInvokingBlocksWithNSInvocationPerformance {
+    RACTuple *arguments = RACTuplePack(@1, @2, @3);
+    id block = ^(NSNumber *first, NSNumber *second, NSNumber *third) {
+        return third;
+    };
+
+    [self measureBlock:^{
+        for (NSUInteger i = 0; i < 1000000; i++) {
+            @autoreleasepool {
+                [[[RACBlockTrampolineTestsInvocation alloc] initWithBlock:block] invokeWithArguments:arguments];
+            }
+        }
+    }];
+}
+
+- (void)testReduceEachPerformance {
+    NSMutableArray *tuples = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 100000; i++) {
+        [tuples addObject:RACTuplePack(@(i), @(i + 1))];
+    }
+
+    RACSignal *signal = [tuples.rac_sequence.signal reduceEach:^(NSNumber *first, NSNumber *second) {
+        return second;
+    }];
+
+    [self measureBlock:^{
+        XCTAssertTrue([signal waitUntilCompleted:NULL]);
+    }];
+}
+
+@end
@@ -0,0 +1,150 @@
+//
+//  RACEventLoopSchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <unistd.h>
+#import "ReactiveObjC.h"
+#import "RACEventLoopScheduler.h"
+
+@interface RACEventLoopSchedulerTests : XCTestCase
+
+// Shared by every test, since the loop's thread is never torn down.
+@property (class, nonatomic, strong, readonly) RACEventLoopScheduler *scheduler;
+
+@end
+
+@implementation RACEventLoopSchedulerTests {
+    int _pipe[2];
+}
+
++ (RACEventLoopScheduler *)scheduler {
+    static RACEventLoopScheduler *scheduler = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        scheduler = [[RACEventLoopScheduler alloc] initWithName:@"RACEventLoopSchedulerTests"];
+    });
+
+    return scheduler;
+}
+
+- (void)setUp {
+    XCTAssertEqual(pipe(_pipe), 0);
+}
+
+- (void)tearDown {
+    if (_pipe[0] >= 0) close(_pipe[0]);
+    if (_pipe[1] >= 0) close(_pipe[1]);
+}
+
+- (void)testBlocksExecuteInOrderOnTheLoop {
+    RACEventLoopScheduler *scheduler = self.class.scheduler;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"all blocks executed"];
+
+    const NSUInteger count = 100;
+    NSMutableArray *order = [NSMutableArray arrayWithCapacity:count];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        [scheduler schedule:^{
+            XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+            XCTAssertEqualObjects(NSThread.currentThread.name, @"RACEventLoopSchedulerTests");
+
+            [order addObject:@(i)];
+            if (i == count - 1) [expectation fulfill];
+        }];
+    }
+
+    [[scheduler schedule:^{
+        XCTFail(@"Disposed block should not execute");
+    }] dispose];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        XCTAssertEqualObjects(order[i], @(i));
+    }
+}
+
+- (void)testTimers {
+    RACEventLoopScheduler *scheduler = self.class.scheduler;
+    XCTestExpectation *delayed = [self expectationWithDescription:@"delayed block executed"];
+    XCTestExpectation *repeated = [self expectationWithDescription:@"repeating block executed three times"];
+
+    NSDate *start = [NSDate date];
+    [scheduler after:[start dateByAddingTimeInterval:0.05] schedule:^{
+        XCTAssertGreaterThanOrEqual(-start.timeIntervalSinceNow, 0.05);
+        XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+        [delayed fulfill];
+    }];
+
+    __block NSUInteger count = 0;
+    __block RACDisposable *disposable = nil;
+    disposable = [scheduler after:start repeatingEvery:0.01 withLeeway:0 schedule:^{
+        if (++count == 3) {
+            [disposable dispose];
+            [repeated fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testReadableSignal {
+    RACEventLoopScheduler *scheduler = self.class.scheduler;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"signal completed"];
+
+    int readFD = _pipe[0];
+    int writeFD = _pipe[1];
+    NSMutableData *received = [NSMutableData data];
+
+    [[RACSignal readableSignalForFileDescriptor:readFD onScheduler:scheduler] subscribeNext:^(NSNumber *available) {
+        XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+        XCTAssertGreaterThan(available.unsignedIntegerValue, 0U);
+
+        char buffer[64];
+        ssize_t length = read(readFD, buffer, MIN(sizeof(buffer), available.unsignedIntegerValue));
+        XCTAssertGreaterThan(length, 0);
+        if (length > 0) [received appendBytes:buffer length:(NSUInteger)length];
+    } error:^(NSError *error) {
+        XCTFail(@"Unexpected error %@", error);
+    } completed:^{
+        [expectation fulfill];
+    }];
+
+    XCTAssertEqual(write(writeFD, "hello", 5), 5);
+    XCTAssertEqual(write(writeFD, " world", 6), 6);
+    close(writeFD);
+    _pipe[1] = -1;
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqualObjects([[NSString alloc] initWithData:received encoding:NSUTF8StringEncoding], @"hello world");
+}
+
+- (void)testWritableSignal {
+    RACEventLoopScheduler *scheduler = self.class.scheduler;
+
+    NSNumber *available = [[[RACSignal writableSignalForFileDescriptor:_pipe[1] onScheduler:scheduler] take:1] asynchronousFirstOrDefault:nil success:NULL error:NULL timeout:5];
+    XCTAssertGreaterThan(available.unsignedIntegerValue, 0U);
+}
+
+- (void)testWatchingAClosedDescriptorFails {
+    RACEventLoopScheduler *scheduler = self.class.scheduler;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"signal errored"];
+
+    int readFD = _pipe[0];
+    close(readFD);
+    _pipe[0] = -1;
+
+    [[RACSignal readableSignalForFileDescriptor:readFD onScheduler:scheduler] subscribeError:^(NSError *error) {
+        XCTAssertNotNil(error);
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+@end
@@ -0,0 +1,112 @@
+//
+//  RACFrameBudgetSchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "RACFrameBudgetScheduler.h"
+
+@interface RACFrameBudgetSchedulerTests : XCTestCase
+
+@end
+
+@implementation RACFrameBudgetSchedulerTests
+
+- (void)testProperties {
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    RACFrameBudgetScheduler *scheduler = [[RACFrameBudgetScheduler alloc] initWithName:nil targetQueue:queue frameInterval:0.02 budget:0.005];
+
+    XCTAssertEqualWithAccuracy(scheduler.frameInterval, 0.02, 1e-9);
+    XCTAssertEqualWithAccuracy(scheduler.budget, 0.005, 1e-9);
+    XCTAssertNotNil(scheduler.idleScheduler);
+    XCTAssertEqual(scheduler.idleScheduler, scheduler.idleScheduler);
+}
+
+- (void)testIdleBlocksExecuteOnceNothingElseIsPending {
+    dispatch_queue_t queue = dispatch_queue_create("RACFrameBudgetSchedulerTests", DISPATCH_QUEUE_SERIAL);
+    RACFrameBudgetScheduler *scheduler = [[RACFrameBudgetScheduler alloc] initWithName:nil targetQueue:queue frameInterval:1 budget:1];
+    RACScheduler *idleScheduler = scheduler.idleScheduler;
+    XCTestExpectation *expectation = [self expectationWithDescription:@"all blocks executed"];
+
+    NSMutableArray *order = [NSMutableArray array];
+
+    // Hold the frame back until everything has been scheduled.
+    dispatch_suspend(queue);
+
+    [idleScheduler schedule:^{
+        XCTAssertEqual(RACScheduler.currentScheduler, idleScheduler);
+        [order addObject:@"idle"];
+        [expectation fulfill];
+    }];
+
+    for (NSUInteger i = 0; i < 3; i++) {
+        [scheduler schedule:^{
+            XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+            [order addObject:@(i)];
+        }];
+    }
+
+    dispatch_resume(queue);
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    XCTAssertEqualObjects(order, (@[ @0, @1, @2, @"idle" ]));
+}
+
+- (void)testWorkBeyondTheBudgetIsDeferredToLaterFrames {
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    RACFrameBudgetScheduler *scheduler = [[RACFrameBudgetScheduler alloc] initWithName:nil targetQueue:queue frameInterval:0.05 budget:0.01];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"all blocks executed"];
+
+    // Each block uses up the whole budget, so only one executes per frame.
+    const NSUInteger count = 4;
+    NSMutableArray<NSNumber *> *startTimes = [NSMutableArray array];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        [scheduler schedule:^{
+            [startTimes addObject:@(RACMonotonicTime())];
+            [NSThread sleepForTimeInterval:0.015];
+
+            if (startTimes.count == count) [expectation fulfill];
+        }];
+    }
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    for (NSUInteger i = 1; i < count; i++) {
+        uint64_t gap = startTimes[i].unsignedLongLongValue - startTimes[i - 1].unsignedLongLongValue;
+        XCTAssertGreaterThanOrEqual(gap, 40 * NSEC_PER_MSEC);
+    }
+}
+
+- (void)testDelayedAndRepeatingBlocks {
+    dispatch_queue_t queue = dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0);
+    RACFrameBudgetScheduler *scheduler = [[RACFrameBudgetScheduler alloc] initWithName:nil targetQueue:queue frameInterval:0.01 budget:0.005];
+    XCTestExpectation *delayed = [self expectationWithDescription:@"delayed idle block executed"];
+    XCTestExpectation *repeated = [self expectationWithDescription:@"repeating block executed three times"];
+
+    [[scheduler after:[NSDate dateWithTimeIntervalSinceNow:0.01] schedule:^{
+        XCTFail(@"Disposed block should not execute");
+    }] dispose];
+
+    [scheduler.idleScheduler after:[NSDate dateWithTimeIntervalSinceNow:0.02] schedule:^{
+        XCTAssertEqual(RACScheduler.currentScheduler, scheduler.idleScheduler);
+        [delayed fulfill];
+    }];
+
+    __block NSUInteger count = 0;
+    __block RACDisposable *disposable = nil;
+    disposable = [scheduler after:[NSDate date] repeatingEvery:0.01 withLeeway:0 schedule:^{
+        if (++count == 3) {
+            [disposable dispose];
+            [repeated fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+@end
@@ -0,0 +1,240 @@
+//
+//  RACLiftingTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "NSInvocation+RACTypeParsing.h"
+
+// Records the arguments that its methods are invoked with.
+@interface RACLiftingTestObject : NSObject
+
+@property (nonatomic, assign) char charValue;
+@property (nonatomic, assign) short shortValue;
+@property (nonatomic, assign) unsigned unsignedValue;
+@property (nonatomic, assign) NSInteger integerValue;
+@property (nonatomic, assign) BOOL boolValue;
+@property (nonatomic, assign) double doubleValue;
+@property (nonatomic, strong) id objectValue;
+
+// The number of times any method has been invoked.
+@property (nonatomic, assign) NSUInteger invocationCount;
+
+@end
+
+@implementation RACLiftingTestObject
+
+- (void)setChar:(char)charValue short:(short)shortValue unsigned:(unsigned)unsignedValue integer:(NSInteger)integerValue {
+    self.invocationCount++;
+    self.charValue = charValue;
+    self.shortValue = shortValue;
+    self.unsignedValue = unsignedValue;
+    self.integerValue = integerValue;
+}
+
+// Has too many arguments to be invoked directly.
+- (void)setChar:(char)charValue short:(short)shortValue unsigned:(unsigned)unsignedValue integer:(NSInteger)integerValue object:(id)object {
+    [self setChar:charValue short:shortValue unsigned:unsignedValue integer:integerValue];
+    self.objectValue = object;
+}
+
+- (void)setFlag:(BOOL)flag {
+    self.invocationCount++;
+    self.boolValue = flag;
+}
+
+- (void)setObject:(id)object {
+    self.invocationCount++;
+    self.objectValue = object;
+}
+
+// Has a floating-point argument, so can't be invoked directly.
+- (void)setDouble:(double)value {
+    self.invocationCount++;
+    self.doubleValue = value;
+}
+
+- (NSString *)joinString:(NSString *)first withString:(NSString *)second {
+    self.invocationCount++;
+    return [NSString stringWithFormat:@"%@-%@", first, second];
+}
+
+- (NSString *)describeInteger:(NSInteger)integer {
+    self.invocationCount++;
+    return @(integer).stringValue;
+}
+
+// Only implemented through forwarding.
+- (NSMethodSignature *)methodSignatureForSelector:(SEL)selector {
+    if (selector == @selector(forwardedObject:)) return [self methodSignatureForSelector:@selector(setObject:)];
+
+    return [super methodSignatureForSelector:selector];
+}
+
+- (void)forwardInvocation:(NSInvocation *)invocation {
+    if (invocation.selector != @selector(forwardedObject:)) {
+        [super forwardInvocation:invocation];
+        return;
+    }
+
+    invocation.selector = @selector(setObject:);
+    [invocation invokeWithTarget:self];
+}
+
+@end
+
+@interface RACLiftingTestObject (Forwarding)
+
+- (void)forwardedObject:(id)object;
+
+@end
+
+@interface RACLiftingTests : XCTestCase
+
+@end
+
+@implementation RACLiftingTests
+
+- (void)testIntegerArguments {
+    RACLiftingTestObject *object = [[RACLiftingTestObject alloc] init];
+
+    [object rac_liftSelector:@selector(setChar:short:unsigned:integer:) withSignals:[RACSignal return:@'x'], [RACSignal return:@(-12)], [RACSignal return:@40000], [RACSignal return:@(NSIntegerMin)], nil];
+
+    XCTAssertEqual(object.invocationCount, 1U);
+    XCTAssertEqual(object.charValue, 'x');
+    XCTAssertEqual(object.shortValue, -12);
+    XCTAssertEqual(object.unsignedValue, 40000U);
+    XCTAssertEqual(object.integerValue, NSIntegerMin);
+}
+
+- (void)testNarrowingMatchesNSInvocation {
+    // Each value is too wide for its parameter, so it's truncated, then sign
+    // or zero extended.
+    RACTuple *arguments = RACTuplePack(@300, @70000, @(-1), @(-5));
+
+    RACLiftingTestObject *lifted = [[RACLiftingTestObject alloc] init];
+    [lifted rac_liftSelector:@selector(setChar:short:unsigned:integer:) withSignalOfArguments:[RACSignal return:arguments]];
+
+    RACLiftingTestObject *invoked = [[RACLiftingTestObject alloc] init];
+    SEL selector = @selector(setChar:short:unsigned:integer:);
+    NSInvocation *invocation = [NSInvocation invocationWithMethodSignature:[invoked methodSignatureForSelector:selector]];
+    invocation.selector = selector;
+    invocation.rac_argumentsTuple = arguments;
+    [invocation invokeWithTarget:invoked];
+
+    XCTAssertEqual(lifted.charValue, (char)44);
+    XCTAssertEqual(lifted.shortValue, (short)4464);
+    XCTAssertEqual(lifted.unsignedValue, UINT_MAX);
+    XCTAssertEqual(lifted.integerValue, -5);
+
+    XCTAssertEqual(lifted.charValue, invoked.charValue);
+    XCTAssertEqual(lifted.shortValue, invoked.shortValue);
+    XCTAssertEqual(lifted.unsignedValue, invoked.unsignedValue);
+    XCTAssertEqual(lifted.integerValue, invoked.integerValue);
+}
+
+- (void)testBoolArguments {
+    RACLiftingTestObject *object = [[RACLiftingTestObject alloc] init];
+    RACSubject *subject = [RACSubject subject];
+
+    [object rac_liftSelector:@selector(setFlag:) withSignals:subject, nil];
+
+    [subject sendNext:@YES];
+    XCTAssertTrue(object.boolValue);
+
+    [subject sendNext:@NO];
+    XCTAssertFalse(object.boolValue);
+
+    [subject sendNext:@2];
+    XCTAssertTrue(object.boolValue);
+
+    XCTAssertEqual(object.invocationCount, 3U);
+}
+
+- (void)testObjectArguments {
+    RACLiftingTestObject *object = [[RACLiftingTestObject alloc] init];
+    RACSubject *subject = [RACSubject subject];
+
+    [object rac_liftSelector:@selector(setObject:) withSignals:subject, nil];
+
+    NSObject *value = [[NSObject alloc] init];
+    [subject sendNext:value];
+    XCTAssertEqual(object.objectValue, value);
+
+    [subject sendNext:nil];
+    XCTAssertNil(object.objectValue);
+}
+
+- (void)testVoidMethodsSendUnit {
+    RACLiftingTestObject *object = [[RACLiftingTestObject alloc] init];
+
+    RACSignal *signal = [object rac_liftSelector:@selector(setObject:) withSignals:[RACSignal return:@1], nil];
+    XCTAssertEqualObjects([signal first], RACUnit.defaultUnit);
+}
+
+- (void)testObjectReturnValues {
+    RACLiftingTestObject *object = [[RACLiftingTestObject alloc] init];
+    RACSubject *second = [RACSubject subject];
+
+    RACSignal *signal = [object rac_liftSelector:@selector(joinString:withString:) withSignals:[RACSignal return:@"a"], second, nil];
+
+    NSMutableArray *values = [NSMutableArray array];
+    [signal subscribeNext:^(NSString *value) {
+        [values addObject:value];
+    }];
+
+    [second sendNext:@"b"];
+    [second sendNext:@"c"];
+    XCTAssertEqualObjects(values, (@[ @"a-b", @"a-c" ]));
+
+    // Lifted signals replay the latest result without invoking the method again.
+    XCTAssertEqualObjects([signal first], @"a-c");
+    XCTAssertEqual(object.invocationCount, 2U);
+
+    RACSignal *described = [object rac_liftSelector:@selector(describeInteger:) withSignals:[RACSignal return:@(-42)], nil];
+    XCTAssertEqualObjects([described first], @"-42");
+}
+
+- (void)testMethodsThatCannotBeInvokedDirectly {
+    RACLiftingTestObject *object = [[RACLiftingTestObject alloc] init];
+
+    [object rac_liftSelector:@selector(setDouble:) withSignals:[RACSignal return:@1.5], nil];
+    XCTAssertEqual(object.doubleValue, 1.5);
+
+    [object rac_liftSelector:@selector(setChar:short:unsigned:integer:object:) withSignals:[RACSignal return:@300], [RACSignal return:@70000], [RACSignal return:@(-1)], [RACSignal return:@(-5)], [RACSignal return:@"object"], nil];
+    XCTAssertEqual(object.charValue, (char)44);
+    XCTAssertEqual(object.shortValue, (short)4464);
+    XCTAssertEqual(object.unsignedValue, UINT_MAX);
+    XCTAssertEqual(object.integerValue, -5);
+    XCTAssertEqualObjects(object.objectValue, @"object");
+}
+
+- (void)testForwardedMethods {
+    RACLiftingTestObject *object = [[RACLiftingTestObject alloc] init];
+
+    [object rac_liftSelector:@selector(forwardedObject:) withSignals:[RACSignal return:@"forwarded"], nil];
+    XCTAssertEqualObjects(object.objectValue, @"forwarded");
+}
+
+- (void)testLiftingStopsWhenTheReceiverDeallocates {
+    RACSubject *subject = [RACSubject subject];
+    __block BOOL completed = NO;
+
+    @autoreleasepool {
+        RACLiftingTestObject *object __attribute__((objc_precise_lifetime)) = [[RACLiftingTestObject alloc] init];
+        [[object rac_liftSelector:@selector(setObject:) withSignals:subject, nil] subscribeCompleted:^{
+            completed = YES;
+        }];
+
+        [subject sendNext:@1];
+        XCTAssertEqualObjects(object.objectValue, @1);
+    }
+
+    XCTAssertTrue(completed);
+}
+
+@end
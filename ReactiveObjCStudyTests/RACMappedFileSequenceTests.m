@@ -0,0 +1,121 @@
+//
+//  RACMappedFileSequenceTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+
+// Returns the given records as UTF-8 encoded data.
+static NSArray<NSData *> *RACMappedFileSequenceTestsData(NSArray<NSString *> *strings) {
+    NSMutableArray *data = [NSMutableArray arrayWithCapacity:strings.count];
+    for (NSString *string in strings) {
+        [data addObject:[string dataUsingEncoding:NSUTF8StringEncoding]];
+    }
+
+    return data;
+}
+
+@interface RACMappedFileSequenceTests : XCTestCase
+
+@property (nonatomic, copy) NSString *path;
+
+@end
+
+@implementation RACMappedFileSequenceTests
+
+- (void)setUp {
+    self.path = [NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString];
+}
+
+- (void)tearDown {
+    [NSFileManager.defaultManager removeItemAtPath:self.path error:NULL];
+}
+
+- (void)writeString:(NSString *)string {
+    NSError *error = nil;
+    XCTAssertTrue([string writeToFile:self.path atomically:YES encoding:NSUTF8StringEncoding error:&error], @"%@", error);
+}
+
+- (RACSequence *)sequenceWithSeparator:(NSString *)separator {
+    NSError *error = nil;
+    RACSequence *sequence = [RACSequence sequenceWithMappedFileAtPath:self.path recordSeparator:[separator dataUsingEncoding:NSUTF8StringEncoding] error:&error];
+    XCTAssertNotNil(sequence, @"%@", error);
+
+    return sequence;
+}
+
+- (void)testRecordsDelimitedBySeparators {
+    [self writeString:@"first\nsecond\n\nfourth\n"];
+
+    RACSequence *sequence = [self sequenceWithSeparator:@"\n"];
+    XCTAssertEqualObjects(sequence.array, RACMappedFileSequenceTestsData(@[ @"first", @"second", @"", @"fourth" ]));
+    XCTAssertEqualObjects(sequence.tail.head, [@"second" dataUsingEncoding:NSUTF8StringEncoding]);
+}
+
+- (void)testMultibyteSeparators {
+    [self writeString:@"a\r\nb\rc\r\nd"];
+
+    RACSequence *sequence = [self sequenceWithSeparator:@"\r\n"];
+    XCTAssertEqualObjects(sequence.array, RACMappedFileSequenceTestsData(@[ @"a", @"b\rc", @"d" ]));
+}
+
+- (void)testFixedLengthRecords {
+    [self writeString:@"abcdefghij"];
+
+    NSError *error = nil;
+    RACSequence *sequence = [RACSequence sequenceWithMappedFileAtPath:self.path recordLength:4 error:&error];
+    XCTAssertNotNil(sequence, @"%@", error);
+
+    XCTAssertEqualObjects(sequence.array, RACMappedFileSequenceTestsData(@[ @"abcd", @"efgh", @"ij" ]));
+}
+
+- (void)testEmptyFiles {
+    [self writeString:@""];
+
+    XCTAssertEqualObjects([self sequenceWithSeparator:@"\n"].array, @[]);
+    XCTAssertEqualObjects([RACSequence sequenceWithMappedFileAtPath:self.path recordLength:4 error:NULL].array, @[]);
+}
+
+- (void)testMissingFiles {
+    NSError *error = nil;
+    RACSequence *sequence = [RACSequence sequenceWithMappedFileAtPath:self.path recordSeparator:[NSData dataWithBytes:"\n" length:1] error:&error];
+
+    XCTAssertNil(sequence);
+    XCTAssertEqualObjects(error.domain, NSPOSIXErrorDomain);
+    XCTAssertEqual(error.code, ENOENT);
+    XCTAssertEqualObjects(error.userInfo[NSFilePathErrorKey], self.path);
+}
+
+- (void)testRecordsOutliveTheSequence {
+    [self writeString:@"first\nsecond"];
+
+    NSData *record = nil;
+    @autoreleasepool {
+        record = [self sequenceWithSeparator:@"\n"].tail.head;
+    }
+
+    XCTAssertEqualObjects(record, [@"second" dataUsingEncoding:NSUTF8StringEncoding]);
+}
+
+- (void)testRecordsAreFoundLazily {
+    NSMutableString *string = [NSMutableString string];
+    for (NSUInteger i = 0; i < 10000; i++) {
+        [string appendFormat:@"%lu\n", (unsigned long)i];
+    }
+
+    [self writeString:string];
+
+    RACSequence *numbers = [[self sequenceWithSeparator:@"\n"] map:^(NSData *record) {
+        return @([[NSString alloc] initWithData:record encoding:NSUTF8StringEncoding].integerValue);
+    }];
+
+    XCTAssertEqualObjects([numbers take:3].array, (@[ @0, @1, @2 ]));
+    XCTAssertEqual(numbers.array.count, 10000U);
+    XCTAssertEqualObjects([[numbers signalWithScheduler:RACScheduler.immediateScheduler] toArray].lastObject, @9999);
+}
+
+@end
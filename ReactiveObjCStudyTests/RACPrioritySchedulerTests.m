@@ -0,0 +1,150 @@
+//
+//  RACPrioritySchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "RACPriorityScheduler.h"
+
+@interface RACPrioritySchedulerTests : XCTestCase
+
+@end
+
+@implementation RACPrioritySchedulerTests
+
+// Occupies the scheduler's executor until the returned semaphore is signalled.
+- (dispatch_semaphore_t)blockScheduler:(RACScheduler *)scheduler {
+    dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+    dispatch_semaphore_t started = dispatch_semaphore_create(0);
+
+    [scheduler schedule:^{
+        dispatch_semaphore_signal(started);
+        dispatch_semaphore_wait(gate, DISPATCH_TIME_FOREVER);
+    }];
+
+    dispatch_semaphore_wait(started, DISPATCH_TIME_FOREVER);
+    return gate;
+}
+
+- (void)testLanes {
+    RACPriorityScheduler *scheduler = [[RACPriorityScheduler alloc] initWithName:nil laneCount:3 earliestDeadlineFirst:NO];
+    XCTAssertEqual(scheduler.laneCount, 3U);
+    XCTAssertEqual(scheduler.lane, 0U);
+    XCTAssertEqual([scheduler schedulerForLane:0], scheduler);
+
+    RACPriorityScheduler *lane = [scheduler schedulerForLane:2];
+    XCTAssertEqual(lane.lane, 2U);
+    XCTAssertEqual(lane.laneCount, 3U);
+    XCTAssertEqual([lane schedulerForLane:2], lane);
+    XCTAssertEqual([lane schedulerForLane:0], scheduler);
+}
+
+- (void)testHigherPriorityLanesExecuteFirst {
+    RACPriorityScheduler *high = [[RACPriorityScheduler alloc] initWithName:nil laneCount:2 earliestDeadlineFirst:NO];
+    RACPriorityScheduler *low = [high schedulerForLane:1];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"all blocks executed"];
+
+    NSMutableArray *order = [NSMutableArray array];
+    dispatch_semaphore_t gate = [self blockScheduler:low];
+
+    [low schedule:^{
+        XCTAssertEqual(RACScheduler.currentScheduler, low);
+        [order addObject:@"low"];
+        [expectation fulfill];
+    }];
+
+    [high schedule:^{
+        XCTAssertEqual(RACScheduler.currentScheduler, high);
+        [order addObject:@"high"];
+    }];
+
+    dispatch_semaphore_signal(gate);
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    XCTAssertEqualObjects(order, (@[ @"high", @"low" ]));
+}
+
+// Makes a timer due before a block is scheduled, but only lets the timer be
+// enqueued afterwards, then returns the order in which the two executed.
+- (NSArray *)orderOfLateTimerAndBlockWithEarliestDeadlineFirst:(BOOL)earliestDeadlineFirst {
+    RACPriorityScheduler *scheduler = [[RACPriorityScheduler alloc] initWithName:nil laneCount:1 earliestDeadlineFirst:earliestDeadlineFirst];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"both blocks executed"];
+
+    NSMutableArray *order = [NSMutableArray array];
+    void (^record)(NSString *) = ^(NSString *name) {
+        [order addObject:name];
+        if (order.count == 2) [expectation fulfill];
+    };
+
+    dispatch_semaphore_t gate = [self blockScheduler:scheduler];
+
+    [scheduler after:[NSDate date] schedule:^{
+        record(@"timer");
+    }];
+
+    [NSThread sleepForTimeInterval:0.05];
+
+    [scheduler schedule:^{
+        record(@"block");
+    }];
+
+    dispatch_semaphore_signal(gate);
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    return order;
+}
+
+- (void)testBlocksExecuteInReadyOrderByDefault {
+    XCTAssertEqualObjects([self orderOfLateTimerAndBlockWithEarliestDeadlineFirst:NO], (@[ @"block", @"timer" ]));
+}
+
+- (void)testBlocksExecuteInDeadlineOrderWithEarliestDeadlineFirst {
+    XCTAssertEqualObjects([self orderOfLateTimerAndBlockWithEarliestDeadlineFirst:YES], (@[ @"timer", @"block" ]));
+}
+
+- (void)testDisposedBlocksDoNotExecute {
+    RACPriorityScheduler *scheduler = [[RACPriorityScheduler alloc] initWithName:nil laneCount:1 earliestDeadlineFirst:YES];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"last block executed"];
+
+    __block BOOL executed = NO;
+    dispatch_semaphore_t gate = [self blockScheduler:scheduler];
+
+    [[scheduler schedule:^{
+        executed = YES;
+    }] dispose];
+
+    [[scheduler after:[NSDate dateWithTimeIntervalSinceNow:0.01] schedule:^{
+        executed = YES;
+    }] dispose];
+
+    [scheduler after:[NSDate dateWithTimeIntervalSinceNow:0.05] schedule:^{
+        [expectation fulfill];
+    }];
+
+    dispatch_semaphore_signal(gate);
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    XCTAssertFalse(executed);
+}
+
+- (void)testRepeatingBlocks {
+    RACPriorityScheduler *scheduler = [[RACPriorityScheduler alloc] initWithName:nil laneCount:2 earliestDeadlineFirst:YES];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"repeating block executed three times"];
+
+    __block NSUInteger count = 0;
+    __block RACDisposable *disposable = nil;
+    disposable = [[scheduler schedulerForLane:1] after:[NSDate date] repeatingEvery:0.01 withLeeway:0 schedule:^{
+        if (++count == 3) {
+            [disposable dispose];
+            [expectation fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+@end
@@ -0,0 +1,212 @@
+//
+//  RACSchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "RACScheduler+Private.h"
+#import "RACScheduler+Subclass.h"
+
+// A scheduler which holds on to its blocks until they're run explicitly.
+@interface RACManualScheduler : RACScheduler
+
+// The disposables returned for every block scheduled so far, in order.
+@property (nonatomic, strong, readonly) NSMutableArray<RACDisposable *> *disposables;
+
+// Runs the oldest block which hasn't been run yet, unless it was disposed.
+- (void)runNextBlock;
+
+@end
+
+@implementation RACManualScheduler {
+    NSMutableArray *_blocks;
+}
+
+- (instancetype)init {
+    self = [super initWithName:@"RACManualScheduler"];
+
+    _blocks = [NSMutableArray array];
+    _disposables = [NSMutableArray array];
+
+    return self;
+}
+
+- (RACDisposable *)schedule:(void (^)(void))block {
+    RACDisposable *disposable = [[RACDisposable alloc] init];
+
+    [_blocks addObject:[block copy]];
+    [_disposables addObject:disposable];
+
+    return disposable;
+}
+
+- (void)runNextBlock {
+    NSUInteger index = _disposables.count - _blocks.count;
+    void (^block)(void) = _blocks.firstObject;
+    [_blocks removeObjectAtIndex:0];
+
+    if (_disposables[index].disposed) return;
+    [self performAsCurrentScheduler:block];
+}
+
+@end
+
+@interface RACSchedulerTests : XCTestCase
+
+@end
+
+@implementation RACSchedulerTests
+
+- (void)testRecursiveSchedulingRunsEveryIteration {
+    RACTestScheduler *scheduler = [[RACTestScheduler alloc] init];
+
+    __block NSUInteger count = 0;
+    [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+        if (++count < 5) reschedule();
+    }];
+
+    XCTAssertEqual(count, 0U);
+
+    [scheduler stepAll];
+    XCTAssertEqual(count, 5U);
+}
+
+- (void)testRecursiveSchedulingOnAQueueScheduler {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"recursion finished"];
+
+    __block NSUInteger count = 0;
+    [[RACScheduler scheduler] scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+        if (++count < 10000) {
+            reschedule();
+        } else {
+            [expectation fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(count, 10000U);
+}
+
+- (void)testDisposingRecursiveSchedulingCancelsQueuedIterations {
+    RACManualScheduler *scheduler = [[RACManualScheduler alloc] init];
+
+    __block NSUInteger count = 0;
+    RACDisposable *disposable = [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+        count++;
+        reschedule();
+    }];
+
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 1U);
+    XCTAssertEqual(scheduler.disposables.count, 2U);
+    XCTAssertFalse(scheduler.disposables.lastObject.disposed);
+
+    [disposable dispose];
+    XCTAssertTrue(scheduler.disposables.lastObject.disposed);
+
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 1U);
+}
+
+- (void)testRecursiveSchedulingKeepsOneIterationPending {
+    RACManualScheduler *scheduler = [[RACManualScheduler alloc] init];
+
+    __block NSUInteger count = 0;
+    RACDisposable *disposable = [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+        if (++count == 1) {
+            reschedule();
+            reschedule();
+        }
+    }];
+
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 1U);
+    XCTAssertEqual(scheduler.disposables.count, 2U);
+
+    // The second reschedule is only scheduled once the first has run.
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 2U);
+    XCTAssertEqual(scheduler.disposables.count, 3U);
+
+    [disposable dispose];
+    XCTAssertTrue(scheduler.disposables.lastObject.disposed);
+
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 2U);
+}
+
+- (void)testReschedulingFromOutsideTheRecursiveBlock {
+    RACManualScheduler *scheduler = [[RACManualScheduler alloc] init];
+
+    __block NSUInteger count = 0;
+    __block void (^savedReschedule)(void) = nil;
+    RACDisposable *disposable = [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+        count++;
+        savedReschedule = reschedule;
+    }];
+
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 1U);
+
+    savedReschedule();
+    savedReschedule();
+    XCTAssertEqual(scheduler.disposables.count, 2U);
+
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 2U);
+    XCTAssertEqual(scheduler.disposables.count, 3U);
+    XCTAssertFalse(scheduler.disposables.lastObject.disposed);
+
+    [scheduler runNextBlock];
+    XCTAssertEqual(count, 3U);
+    XCTAssertEqual(scheduler.disposables.count, 3U);
+
+    savedReschedule = nil;
+    [disposable dispose];
+}
+
+- (void)testDisposingRecursiveSchedulingReleasesTheBlock {
+    RACManualScheduler *scheduler = [[RACManualScheduler alloc] init];
+
+    __weak id weakObject = nil;
+    RACDisposable *disposable = nil;
+
+    @autoreleasepool {
+        NSObject *object = [[NSObject alloc] init];
+        weakObject = object;
+
+        disposable = [scheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+            [object description];
+            reschedule();
+        }];
+
+        [scheduler runNextBlock];
+        [disposable dispose];
+    }
+
+    XCTAssertNil(weakObject);
+}
+
+- (void)testSignalWithSchedulerPerformance {
+    NSMutableArray *values = [NSMutableArray arrayWithCapacity:1000000];
+    for (NSUInteger i = 0; i < 1000000; i++) {
+        [values addObject:@(i)];
+    }
+
+    RACSignal *signal = [values.rac_sequence signalWithScheduler:[RACScheduler scheduler]];
+
+    [self measureBlock:^{
+        __block NSUInteger count = 0;
+        [[signal doNext:^(id x) {
+            count++;
+        }] waitUntilCompleted:NULL];
+
+        XCTAssertEqual(count, 1000000U);
+    }];
+}
+
+@end
@@ -0,0 +1,998 @@
+//
+//  RACSequenceTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <libkern/OSAtomic.h>
+#import "ReactiveObjC.h"
+#import "RACStreamingSequence.h"
+
+// Returns an array of the NSNumbers from 0 up to, but not including, `count`.
+static NSArray<NSNumber *> *RACSequenceTestsNumbers(NSUInteger count) {
+    NSMutableArray *numbers = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [numbers addObject:@(i)];
+    }
+
+    return numbers;
+}
+
+// Returns an infinite lazy sequence of the NSNumbers from `start` upwards.
+static RACSequence<NSNumber *> *RACSequenceTestsNaturals(NSUInteger start) {
+    return [RACSequence sequenceWithHeadBlock:^{
+        return @(start);
+    } tailBlock:^{
+        return RACSequenceTestsNaturals(start + 1);
+    }];
+}
+
+// Returns a streaming sequence of the NSNumbers from 0 up to, but not including,
+// `count`, which counts how many times its generator has been invoked.
+static RACSequence<NSNumber *> *RACSequenceTestsStreamingNumbers(NSUInteger count, NSUInteger *generated) {
+    __block NSUInteger next = 0;
+    return [RACStreamingSequence sequenceWithGenerator:^ id {
+        if (next == count) return nil;
+
+        if (generated != NULL) (*generated)++;
+        return @(next++);
+    }];
+}
+
+// Returns a lazy sequence of the NSNumbers from `start` up to, but not
+// including, `end`, where each node creates the next.
+static RACSequence<NSNumber *> *RACSequenceTestsLazyNumbers(NSUInteger start, NSUInteger end) {
+    if (start >= end) return RACSequence.empty;
+
+    return [RACSequence sequenceWithHeadBlock:^{
+        return @(start);
+    } tailBlock:^{
+        return RACSequenceTestsLazyNumbers(start + 1, end);
+    }];
+}
+
+// Whether to run the checks on 10M-element chains, which take a long time and a
+// lot of memory. Set RAC_LONG_SEQUENCE_TESTS in the scheme's environment to run
+// them.
+static BOOL RACSequenceTestsLongChainsEnabled(void) {
+    return NSProcessInfo.processInfo.environment[@"RAC_LONG_SEQUENCE_TESTS"] != nil;
+}
+
+@interface RACSequenceTests : XCTestCase
+
+@end
+
+@implementation RACSequenceTests
+
+#pragma mark Signals
+
+- (void)testSignalWithSchedulerSendsValuesInBatches {
+    RACTestScheduler *scheduler = [[RACTestScheduler alloc] init];
+    NSArray *numbers = RACSequenceTestsNumbers(250);
+
+    NSMutableArray *values = [NSMutableArray array];
+    __block BOOL completed = NO;
+    [[numbers.rac_sequence signalWithScheduler:scheduler quantum:100 timeBudget:0] subscribeNext:^(id x) {
+        [values addObject:x];
+    } completed:^{
+        completed = YES;
+    }];
+
+    XCTAssertEqual(values.count, 0U);
+
+    [scheduler step];
+    XCTAssertEqual(values.count, 100U);
+
+    [scheduler step];
+    XCTAssertEqual(values.count, 200U);
+
+    [scheduler step];
+    XCTAssertEqualObjects(values, numbers);
+    XCTAssertTrue(completed);
+}
+
+- (void)testSignalWithSchedulerSendsEveryValueWithinATimeBudget {
+    NSArray *numbers = RACSequenceTestsNumbers(10000);
+
+    RACSignal *signal = [numbers.rac_sequence signalWithScheduler:[RACScheduler scheduler] quantum:NSUIntegerMax timeBudget:0.0001];
+    XCTAssertEqualObjects([signal toArray], numbers);
+}
+
+- (void)testSignalWithSchedulerStopsWithinABatchWhenDisposed {
+    RACTestScheduler *scheduler = [[RACTestScheduler alloc] init];
+
+    NSMutableArray *values = [NSMutableArray array];
+    __block RACDisposable *disposable = nil;
+    disposable = [[RACSequenceTestsNumbers(100).rac_sequence signalWithScheduler:scheduler quantum:100 timeBudget:0] subscribeNext:^(NSNumber *x) {
+        [values addObject:x];
+        if (x.integerValue == 9) [disposable dispose];
+    }];
+
+    [scheduler stepAll];
+    XCTAssertEqualObjects(values, RACSequenceTestsNumbers(10));
+}
+
+- (void)testSignalOfAnArraySequenceTail {
+    RACSequence *sequence = @[ @0, @1, @2, @3 ].rac_sequence.tail.tail;
+    XCTAssertEqualObjects([[sequence signalWithScheduler:RACScheduler.immediateScheduler] toArray], (@[ @2, @3 ]));
+}
+
+#pragma mark Fused Operators
+
+- (void)testFusedOperators {
+    RACSequence *sequence = [[[[[RACSequenceTestsNumbers(20).rac_sequence
+        map:^(NSNumber *x) {
+            return @(x.integerValue * 2);
+        }]
+        filter:^(NSNumber *x) {
+            return (BOOL)(x.integerValue % 3 != 0);
+        }]
+        skip:2]
+        take:4]
+        scanWithStart:@0 reduce:^(NSNumber *running, NSNumber *x) {
+            return @(running.integerValue + x.integerValue);
+        }];
+
+    // 2, 4, 8, 10, 14, 16, ... skipping two, then taking four.
+    XCTAssertEqualObjects(sequence.array, (@[ @8, @18, @32, @48 ]));
+}
+
+- (void)testFusedPipelinesEvaluateEachValueOnce {
+    __block NSUInteger evaluations = 0;
+    RACSequence *sequence = [RACSequenceTestsNumbers(10).rac_sequence map:^(NSNumber *x) {
+        evaluations++;
+        return [[NSObject alloc] init];
+    }];
+
+    id head = sequence.head;
+    id second = sequence.tail.head;
+    XCTAssertEqual(evaluations, 2U);
+
+    NSArray *array = sequence.array;
+    XCTAssertEqual(array.count, 10U);
+    XCTAssertEqual(evaluations, 10U);
+
+    // Every consumer sees the same memoized values.
+    XCTAssertEqual(array.firstObject, head);
+    XCTAssertEqual(array[1], second);
+    XCTAssertEqual(sequence.head, array.firstObject);
+
+    NSUInteger index = 0;
+    for (id value in sequence) {
+        XCTAssertEqual(value, array[index]);
+        index++;
+    }
+
+    XCTAssertEqual(index, 10U);
+    XCTAssertEqual([[sequence foldLeftWithStart:@0 reduce:^(NSNumber *count, id value) {
+        return @(count.unsignedIntegerValue + 1);
+    }] unsignedIntegerValue], 10U);
+
+    XCTAssertEqualObjects(sequence.tail.tail.array, [array subarrayWithRange:NSMakeRange(2, 8)]);
+    XCTAssertEqual(evaluations, 10U);
+}
+
+- (void)testFusingOntoAnEvaluatedPipelineDoesNotReevaluateIt {
+    __block NSUInteger evaluations = 0;
+    RACSequence *sequence = [RACSequenceTestsNumbers(5).rac_sequence map:^(NSNumber *x) {
+        evaluations++;
+        return @(x.integerValue + 1);
+    }];
+
+    XCTAssertEqualObjects(sequence.head, @1);
+
+    RACSequence *doubled = [sequence map:^(NSNumber *x) {
+        return @(x.integerValue * 2);
+    }];
+
+    XCTAssertEqualObjects(doubled.array, (@[ @2, @4, @6, @8, @10 ]));
+    XCTAssertEqualObjects(sequence.array, (@[ @1, @2, @3, @4, @5 ]));
+    XCTAssertEqual(evaluations, 5U);
+}
+
+- (void)testUnevaluatedPipelinesCanBeSharedByBranches {
+    RACSequence *sequence = [RACSequenceTestsNumbers(5).rac_sequence map:^(NSNumber *x) {
+        return @(x.integerValue + 1);
+    }];
+
+    RACSequence *evens = [sequence filter:^(NSNumber *x) {
+        return (BOOL)(x.integerValue % 2 == 0);
+    }];
+
+    RACSequence *odds = [sequence filter:^(NSNumber *x) {
+        return (BOOL)(x.integerValue % 2 == 1);
+    }];
+
+    XCTAssertEqualObjects(evens.array, (@[ @2, @4 ]));
+    XCTAssertEqualObjects(odds.array, (@[ @1, @3, @5 ]));
+    XCTAssertEqualObjects(sequence.array, (@[ @1, @2, @3, @4, @5 ]));
+}
+
+- (void)testFusedTakeStopsPullingFromTheSource {
+    __block NSUInteger evaluations = 0;
+    RACSequence *sequence = [[RACSequenceTestsNaturals(0) map:^(NSNumber *x) {
+        evaluations++;
+        return x;
+    }] take:3];
+
+    XCTAssertEqualObjects(sequence.array, (@[ @0, @1, @2 ]));
+    XCTAssertEqual(evaluations, 3U);
+}
+
+- (void)testFusedPipelinesAreLazy {
+    __block NSUInteger evaluations = 0;
+    RACSequence *sequence = [RACSequenceTestsNaturals(0) map:^(NSNumber *x) {
+        evaluations++;
+        return x;
+    }];
+
+    XCTAssertEqual(evaluations, 0U);
+    XCTAssertEqualObjects(sequence.tail.tail.head, @2);
+    XCTAssertEqual(evaluations, 3U);
+}
+
+#pragma mark Fast Enumeration
+
+// Returns every value of the sequence, read with fast enumeration.
+static NSArray *RACSequenceTestsEnumerate(RACSequence *sequence) {
+    NSMutableArray *values = [NSMutableArray array];
+    for (id value in sequence) {
+        [values addObject:value];
+    }
+
+    return values;
+}
+
+- (void)testEnumeratingArraySequences {
+    NSArray *numbers = RACSequenceTestsNumbers(100);
+    RACSequence *sequence = numbers.rac_sequence;
+
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(sequence), numbers);
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(sequence.tail.tail), [numbers subarrayWithRange:NSMakeRange(2, 98)]);
+    XCTAssertEqualObjects(sequence.tail.tail.array, [numbers subarrayWithRange:NSMakeRange(2, 98)]);
+}
+
+- (void)testEnumeratingTupleSequences {
+    RACTuple *tuple = RACTuplePack(@1, nil, @3);
+
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(tuple.rac_sequence), (@[ @1, NSNull.null, @3 ]));
+    XCTAssertEqualObjects(tuple.rac_sequence.array, (@[ @1, NSNull.null, @3 ]));
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(tuple.rac_sequence.tail), (@[ NSNull.null, @3 ]));
+
+    RACTuple *largeTuple = [RACTuple tupleWithObjectsFromArray:RACSequenceTestsNumbers(40)];
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(largeTuple.rac_sequence), RACSequenceTestsNumbers(40));
+}
+
+- (void)testEnumeratingStringSequences {
+    NSMutableString *string = [NSMutableString string];
+    NSMutableArray *characters = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 100; i++) {
+        unichar character = (unichar)('a' + i % 26);
+        [string appendFormat:@"%C", character];
+        [characters addObject:[NSString stringWithFormat:@"%C", character]];
+    }
+
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(string.rac_sequence), characters);
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(string.rac_sequence.tail), [characters subarrayWithRange:NSMakeRange(1, 99)]);
+}
+
+- (void)testFusedPipelinesOverStringSequences {
+    // The string sequence creates each character as it's enumerated, so the
+    // pipeline has to retain them while they're buffered.
+    NSMutableString *string = [NSMutableString string];
+    NSMutableArray *uppercase = [NSMutableArray array];
+    for (NSUInteger i = 0; i < 100; i++) {
+        unichar character = (unichar)('a' + i % 26);
+        [string appendFormat:@"%C", character];
+        [uppercase addObject:[NSString stringWithFormat:@"%C", (unichar)('A' + i % 26)]];
+    }
+
+    RACSequence *sequence = [string.rac_sequence map:^(NSString *character) {
+        return character.uppercaseString;
+    }];
+
+    XCTAssertEqualObjects(sequence.array, uppercase);
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(sequence), uppercase);
+}
+
+- (void)testDictionarySequences {
+    NSDictionary *dictionary = @{ @"a": @1, @"b": @2, @"c": @3 };
+
+    NSMutableDictionary *rebuilt = [NSMutableDictionary dictionary];
+    for (RACTwoTuple *tuple in dictionary.rac_sequence) {
+        XCTAssertEqual(tuple.count, 2U);
+        rebuilt[tuple.first] = tuple.second;
+    }
+
+    XCTAssertEqualObjects(rebuilt, dictionary);
+    XCTAssertEqual(dictionary.rac_sequence.array.count, 3U);
+    XCTAssertEqualObjects([NSSet setWithArray:dictionary.rac_keySequence.array], ([NSSet setWithObjects:@"a", @"b", @"c", nil]));
+    XCTAssertEqualObjects([NSSet setWithArray:dictionary.rac_valueSequence.array], ([NSSet setWithObjects:@1, @2, @3, nil]));
+}
+
+#pragma mark Parallel Operations
+
+- (void)testParallelMapPreservesOrder {
+    NSArray *numbers = RACSequenceTestsNumbers(10000);
+
+    NSArray *mapped = [numbers.rac_sequence parallelMap:^(NSNumber *x) {
+        return @(x.integerValue * 2);
+    }].array;
+
+    XCTAssertEqual(mapped.count, numbers.count);
+    for (NSUInteger i = 0; i < mapped.count; i++) {
+        XCTAssertEqualObjects(mapped[i], @(i * 2));
+    }
+}
+
+- (void)testParallelMapOmitsNilValues {
+    RACSequence *sequence = [RACSequenceTestsNumbers(10).rac_sequence parallelMap:^ id (NSNumber *x) {
+        return (x.integerValue % 2 == 0 ? x : nil);
+    }];
+
+    XCTAssertEqualObjects(sequence.array, (@[ @0, @2, @4, @6, @8 ]));
+}
+
+- (void)testParallelFilterPreservesOrder {
+    RACSequence *sequence = [RACSequenceTestsNumbers(1000).rac_sequence parallelFilter:^(NSNumber *x) {
+        return (BOOL)(x.integerValue % 100 == 0);
+    }];
+
+    XCTAssertEqualObjects(sequence.array, (@[ @0, @100, @200, @300, @400, @500, @600, @700, @800, @900 ]));
+}
+
+- (void)testParallelOperationsPreserveEagerness {
+    RACSequence *eager = RACSequenceTestsNumbers(10).rac_sequence.eagerSequence;
+
+    XCTAssertTrue([[eager parallelMap:^(id x) { return x; }] isKindOfClass:eager.class]);
+    XCTAssertTrue([[eager parallelFilter:^(id x) { return YES; }] isKindOfClass:eager.class]);
+
+    RACSequence *lazy = RACSequenceTestsNumbers(10).rac_sequence;
+    XCTAssertFalse([[lazy parallelMap:^(id x) { return x; }] isKindOfClass:eager.class]);
+}
+
+- (void)testParallelOperationsOnEmptySequences {
+    XCTAssertEqualObjects([RACSequence.empty parallelMap:^(id x) { return x; }].array, @[]);
+    XCTAssertEqualObjects([RACSequence.empty parallelFilter:^(id x) { return YES; }].array, @[]);
+    XCTAssertEqualObjects([RACSequence.empty parallelReduceWithStart:@0 combine:^(id running, id x) { return x; }], @0);
+}
+
+- (void)testParallelReduceMatchesFoldLeft {
+    RACSequence *sequence = RACSequenceTestsNumbers(10000).rac_sequence;
+
+    NSNumber *sum = [sequence parallelReduceWithStart:@0 combine:^(NSNumber *running, NSNumber *x) {
+        return @(running.integerValue + x.integerValue);
+    }];
+
+    XCTAssertEqualObjects(sum, @(9999 * 10000 / 2));
+
+    // Concatenation isn't commutative, so this also checks that runs are
+    // combined in order.
+    RACSequence *strings = [sequence map:^(NSNumber *x) {
+        return x.stringValue;
+    }];
+
+    NSString *(^concatenate)(NSString *, NSString *) = ^(NSString *running, NSString *x) {
+        return [running stringByAppendingString:x];
+    };
+
+    XCTAssertEqualObjects([strings parallelReduceWithStart:@"" combine:concatenate], [strings foldLeftWithStart:@"" reduce:concatenate]);
+}
+
+- (void)testChunksOfSize {
+    RACSequence *chunks = [RACSequenceTestsNumbers(7).rac_sequence chunksOfSize:3];
+    XCTAssertEqualObjects(chunks.array, (@[ @[ @0, @1, @2 ], @[ @3, @4, @5 ], @[ @6 ] ]));
+
+    XCTAssertEqualObjects([RACSequenceTestsNumbers(6).rac_sequence chunksOfSize:3].array, (@[ @[ @0, @1, @2 ], @[ @3, @4, @5 ] ]));
+    XCTAssertEqualObjects([RACSequence.empty chunksOfSize:3].array, @[]);
+}
+
+- (void)testChunksAreEvaluatedOnlyWhenNeeded {
+    __block NSUInteger evaluations = 0;
+    RACSequence *chunks = [[RACSequenceTestsNaturals(0) map:^(NSNumber *x) {
+        evaluations++;
+        return x;
+    }] chunksOfSize:4];
+
+    XCTAssertEqual(evaluations, 0U);
+    XCTAssertEqualObjects(chunks.head, (@[ @0, @1, @2, @3 ]));
+    XCTAssertEqual(evaluations, 4U);
+
+    XCTAssertEqualObjects(chunks.tail.head, (@[ @4, @5, @6, @7 ]));
+    XCTAssertEqual(evaluations, 8U);
+}
+
+#pragma mark Signal Sequences
+
+- (void)testSignalSequencesSubscribeOnce {
+    __block NSUInteger subscriptions = 0;
+    RACSignal *signal = [RACSignal createSignal:^ RACDisposable * (id<RACSubscriber> subscriber) {
+        subscriptions++;
+        for (NSNumber *number in RACSequenceTestsNumbers(1000)) {
+            [subscriber sendNext:number];
+        }
+
+        [subscriber sendCompleted];
+        return nil;
+    }];
+
+    RACSequence *sequence = signal.sequence;
+
+    NSUInteger count = 0;
+    for (RACSequence *rest = sequence; rest.head != nil; rest = rest.tail) {
+        XCTAssertEqualObjects(rest.head, @(count));
+        count++;
+    }
+
+    XCTAssertEqual(count, 1000U);
+    XCTAssertEqualObjects(sequence.tail.tail.array, [RACSequenceTestsNumbers(1000) subarrayWithRange:NSMakeRange(2, 998)]);
+    XCTAssertEqual(subscriptions, 1U);
+}
+
+- (void)testSignalSequencesRepresentNilsAsNSNull {
+    RACSignal *signal = [RACSignal createSignal:^ RACDisposable * (id<RACSubscriber> subscriber) {
+        [subscriber sendNext:@1];
+        [subscriber sendNext:nil];
+        [subscriber sendNext:@3];
+        [subscriber sendCompleted];
+        return nil;
+    }];
+
+    XCTAssertEqualObjects(signal.sequence.array, (@[ @1, NSNull.null, @3 ]));
+}
+
+- (void)testSignalSequencesBlockUntilValuesAreSent {
+    RACSubject *subject = [RACReplaySubject subject];
+    RACSequence *sequence = subject.sequence;
+
+    dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(0.05 * NSEC_PER_SEC)), dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        [subject sendNext:@0];
+        [subject sendNext:@1];
+        [subject sendCompleted];
+    });
+
+    XCTAssertEqualObjects(sequence.head, @0);
+    XCTAssertEqualObjects(sequence.tail.head, @1);
+    XCTAssertNil(sequence.tail.tail.head);
+    XCTAssertEqualObjects(sequence.array, (@[ @0, @1 ]));
+}
+
+- (void)testSignalSequencesEndWhenTheSignalErrors {
+    RACSignal *signal = [[RACSignal return:@0] concat:[RACSignal error:nil]];
+    RACSequence *sequence = signal.sequence;
+
+    XCTAssertEqualObjects(sequence.head, @0);
+    XCTAssertNil(sequence.tail.head);
+    XCTAssertEqualObjects(sequence.array, @[ @0 ]);
+}
+
+#pragma mark Streaming Sequences
+
+- (void)testStreamingSequencesAreSinglePass {
+    NSUInteger generated = 0;
+    RACSequence *sequence = RACSequenceTestsStreamingNumbers(100, &generated);
+
+    XCTAssertEqual(generated, 0U);
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(sequence), RACSequenceTestsNumbers(100));
+    XCTAssertEqual(generated, 100U);
+
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(sequence), @[]);
+    XCTAssertEqualObjects(sequence.array, @[]);
+    XCTAssertEqual(generated, 100U);
+}
+
+- (void)testStreamingSequencesHandEachValueToOneConsumer {
+    RACStreamingSequence *sequence = (RACStreamingSequence *)RACSequenceTestsStreamingNumbers(10, NULL);
+
+    XCTAssertEqualObjects(sequence.nextObject, @0);
+    XCTAssertEqualObjects(sequence.nextObject, @1);
+    XCTAssertEqualObjects(sequence.array, (@[ @2, @3, @4, @5, @6, @7, @8, @9 ]));
+    XCTAssertNil(sequence.nextObject);
+}
+
+- (void)testStreamingSequencesDoNotRetainConsumedValues {
+    __weak id firstValue = nil;
+    __block NSUInteger produced = 0;
+
+    RACSequence *sequence = [RACStreamingSequence sequenceWithGenerator:^ id {
+        if (produced == 1000) return nil;
+
+        produced++;
+        return [[NSObject alloc] init];
+    }];
+
+    @autoreleasepool {
+        for (id value in sequence) {
+            if (firstValue == nil) firstValue = value;
+        }
+    }
+
+    // The sequence is still alive, but the values it handed out aren't.
+    XCTAssertNotNil(sequence);
+    XCTAssertEqual(produced, 1000U);
+    XCTAssertNil(firstValue);
+}
+
+- (void)testOperatorsOnStreamingSequencesDoNotRetainConsumedValues {
+    __weak id firstValue = nil;
+    NSUInteger generated = 0;
+
+    RACSequence *sequence = [[RACSequenceTestsStreamingNumbers(1000, &generated).streamingSequence map:^(NSNumber *x) {
+        return [NSMutableArray arrayWithObject:x];
+    }] filter:^(NSArray *array) {
+        return YES;
+    }];
+
+    XCTAssertTrue([sequence isKindOfClass:RACStreamingSequence.class]);
+
+    NSUInteger count = 0;
+    @autoreleasepool {
+        for (id value in sequence) {
+            if (firstValue == nil) firstValue = value;
+            count++;
+        }
+    }
+
+    // The pipeline is still alive, but the values it produced aren't.
+    XCTAssertNotNil(sequence);
+    XCTAssertEqual(count, 1000U);
+    XCTAssertEqual(generated, 1000U);
+    XCTAssertNil(firstValue);
+    XCTAssertEqualObjects(sequence.array, @[]);
+}
+
+- (void)testOperatorsOnStreamingSequencesOnlyPullWhatTheyNeed {
+    NSUInteger generated = 0;
+    RACStreamingSequence *source = (RACStreamingSequence *)RACSequenceTestsStreamingNumbers(10, &generated);
+
+    RACSequence *mapped = [source map:^(NSNumber *x) {
+        return @(x.integerValue * 2);
+    }];
+
+    RACSequence *taken = [[mapped filter:^(NSNumber *x) {
+        return (BOOL)(x.integerValue % 4 == 0);
+    }] take:3];
+
+    XCTAssertEqual(generated, 0U);
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(taken), (@[ @0, @4, @8 ]));
+
+    // Only the values up to the last one taken were pulled from the source,
+    // which continues from there.
+    XCTAssertEqual(generated, 5U);
+    XCTAssertEqualObjects(source.nextObject, @5);
+}
+
+- (void)testStreamingSequencesMemoizeOnceHeadIsAccessed {
+    NSUInteger generated = 0;
+    RACSequence *sequence = RACSequenceTestsStreamingNumbers(5, &generated);
+
+    XCTAssertEqualObjects(sequence.head, @0);
+    XCTAssertEqualObjects(sequence.tail.head, @1);
+    XCTAssertEqualObjects(sequence.head, @0);
+    XCTAssertEqual(generated, 2U);
+
+    // Enumeration continues from the first value that hasn't been consumed.
+    XCTAssertEqualObjects(sequence.array, (@[ @0, @1, @2, @3, @4 ]));
+    XCTAssertEqualObjects(sequence.tail.tail.head, @2);
+    XCTAssertEqual(generated, 5U);
+}
+
+- (void)testMemoizedSequences {
+    NSUInteger generated = 0;
+    RACSequence *streaming = RACSequenceTestsStreamingNumbers(5, &generated);
+    RACSequence *memoized = streaming.memoizedSequence;
+
+    XCTAssertEqual(streaming.memoizedSequence, memoized);
+    XCTAssertEqualObjects(memoized.array, (@[ @0, @1, @2, @3, @4 ]));
+    XCTAssertEqualObjects(memoized.array, (@[ @0, @1, @2, @3, @4 ]));
+    XCTAssertEqual(generated, 5U);
+
+    RACSequence *lazy = RACSequenceTestsNumbers(5).rac_sequence;
+    XCTAssertEqual(lazy.memoizedSequence, lazy);
+    XCTAssertEqual(streaming.streamingSequence, streaming);
+}
+
+- (void)testConvertingSequencesToStreamingSequences {
+    RACSequence *sequence = [RACSequenceTestsNaturals(0) take:100].streamingSequence;
+
+    XCTAssertTrue([sequence isKindOfClass:RACStreamingSequence.class]);
+    XCTAssertEqualObjects(RACSequenceTestsEnumerate(sequence), RACSequenceTestsNumbers(100));
+    XCTAssertEqualObjects(sequence.array, @[]);
+}
+
+- (void)testEnumeratorStreamingSequences {
+    NSEnumerator *enumerator = RACSequenceTestsNumbers(100).objectEnumerator;
+    RACSequence *sequence = enumerator.rac_streamingSequence;
+
+    NSNumber *sum = [sequence foldLeftWithStart:@0 reduce:^(NSNumber *running, NSNumber *x) {
+        return @(running.integerValue + x.integerValue);
+    }];
+
+    XCTAssertEqualObjects(sum, @(99 * 100 / 2));
+    XCTAssertNil(enumerator.nextObject);
+}
+
+- (void)testStreamingSequenceSignals {
+    RACSequence *sequence = RACSequenceTestsStreamingNumbers(250, NULL);
+    RACSignal *signal = [sequence signalWithScheduler:RACScheduler.immediateScheduler quantum:100 timeBudget:0];
+
+    XCTAssertEqualObjects([signal toArray], RACSequenceTestsNumbers(250));
+
+    // The signal consumed the values, rather than memoizing them.
+    XCTAssertEqualObjects([signal toArray], @[]);
+    XCTAssertEqualObjects(sequence.array, @[]);
+}
+
+- (void)testStreamingSequenceEnumerators {
+    NSUInteger generated = 0;
+    RACSequence *sequence = RACSequenceTestsStreamingNumbers(5, &generated);
+
+    NSEnumerator *enumerator = sequence.objectEnumerator;
+    XCTAssertEqual(generated, 0U);
+    XCTAssertEqualObjects(enumerator.nextObject, @0);
+    XCTAssertEqual(generated, 1U);
+
+    // The enumerator and the sequence consume the same values.
+    XCTAssertEqualObjects([(RACStreamingSequence *)sequence nextObject], @1);
+    XCTAssertEqualObjects(enumerator.allObjects, (@[ @2, @3, @4 ]));
+    XCTAssertNil(enumerator.nextObject);
+    XCTAssertEqual(generated, 5U);
+}
+
+#pragma mark Long Chains
+
+// Invokes `block` on a new thread with a secondary thread's default stack size,
+// which is much smaller than the main thread's, and waits for it to finish.
+- (void)performOnSecondaryThread:(void (^)(void))block {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"thread finished"];
+
+    NSThread *thread = [[NSThread alloc] initWithBlock:^{
+        block();
+        [expectation fulfill];
+    }];
+
+    thread.stackSize = 512 * 1024;
+    [thread start];
+
+    [self waitForExpectationsWithTimeout:600 handler:nil];
+}
+
+// Evaluates a chain of `count` lazy nodes while holding onto the first, then
+// releases the whole chain at once.
+- (void)verifyReleasingChainOfLength:(NSUInteger)count {
+    __weak RACSequence *weakLast = nil;
+
+    @autoreleasepool {
+        RACSequence *sequence = RACSequenceTestsNaturals(0);
+
+        RACSequence *rest = sequence;
+        for (NSUInteger i = 0; i < count; i++) {
+            @autoreleasepool {
+                rest = rest.tail;
+            }
+        }
+
+        XCTAssertEqualObjects(rest.head, @(count));
+        weakLast = rest;
+        rest = nil;
+
+        XCTAssertNotNil(weakLast);
+    }
+
+    XCTAssertNil(weakLast);
+}
+
+// Right folds over array-backed and lazy sequences of `count` values.
+- (void)verifyRightFoldOfLength:(NSUInteger)count {
+    NSArray *sequences = @[
+        RACSequenceTestsNumbers(count).rac_sequence,
+        RACSequenceTestsLazyNumbers(0, count),
+        [RACSequenceTestsNaturals(0) take:count],
+        [[RACSequenceTestsNaturals(1) map:^(NSNumber *x) {
+            return @(x.unsignedIntegerValue - 1);
+        }] take:count],
+    ];
+
+    for (RACSequence *sequence in sequences) {
+        @autoreleasepool {
+            NSNumber *sum = [sequence foldRightWithStart:@0 reduce:^(NSNumber *first, RACSequence *rest) {
+                return @(first.unsignedIntegerValue + [rest.head unsignedIntegerValue]);
+            }];
+
+            XCTAssertEqualObjects(sum, @((count - 1) * count / 2), @"%@", sequence);
+        }
+    }
+}
+
+- (void)testReleasingLongChains {
+    [self performOnSecondaryThread:^{
+        [self verifyReleasingChainOfLength:100000];
+    }];
+}
+
+- (void)testReleasingLongChainsOnSeveralThreadsAtOnce {
+    dispatch_apply(4, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        [self verifyReleasingChainOfLength:50000];
+    });
+}
+
+- (void)testRightFoldsOverLongSequences {
+    [self performOnSecondaryThread:^{
+        [self verifyRightFoldOfLength:100000];
+    }];
+}
+
+- (void)testRightFoldsMatchTheRecursiveDefinition {
+    NSArray *(^prepend)(id, RACSequence *) = ^(id first, RACSequence *rest) {
+        return [@[ first ] arrayByAddingObjectsFromArray:rest.head];
+    };
+
+    // Past the depth at which the remainder is folded iteratively.
+    NSArray *numbers = RACSequenceTestsNumbers(1000);
+    XCTAssertEqualObjects([numbers.rac_sequence foldRightWithStart:@[] reduce:prepend], numbers);
+
+    RACSequence *lazy = [RACSequenceTestsNaturals(0) take:1000];
+    XCTAssertEqualObjects([lazy foldRightWithStart:@[] reduce:prepend], numbers);
+}
+
+- (void)testRightFoldsOverInfiniteSequencesThatStopEarly {
+    // This stops accessing `rest.head` well within the depth limit, so it has
+    // to end without evaluating the rest of the sequence.
+    NSNumber *found = [RACSequenceTestsNaturals(0) foldRightWithStart:nil reduce:^(NSNumber *first, RACSequence *rest) {
+        return (first.unsignedIntegerValue > 100 ? first : rest.head);
+    }];
+
+    XCTAssertEqualObjects(found, @101);
+}
+
+- (void)testRightFoldDepthIsRestoredAfterAnException {
+    id (^throwing)(NSNumber *, RACSequence *) = ^(NSNumber *first, RACSequence *rest) {
+        if (first.unsignedIntegerValue == 200) {
+            @throw [NSException exceptionWithName:@"RACSequenceTestsException" reason:nil userInfo:nil];
+        }
+
+        return rest.head;
+    };
+
+    XCTAssertThrows([RACSequenceTestsNaturals(0) foldRightWithStart:nil reduce:throwing]);
+    XCTAssertThrows([RACSequenceTestsNaturals(0) foldRightWithStart:nil reduce:throwing]);
+
+    // If the depth had leaked, this would be past the limit straight away, and
+    // would evaluate the whole sequence iteratively.
+    __block NSUInteger evaluations = 0;
+    RACSequence *sequence = [[RACSequenceTestsNaturals(0) map:^(NSNumber *x) {
+        evaluations++;
+        return x;
+    }] take:1000];
+
+    NSNumber *found = [sequence foldRightWithStart:nil reduce:^(NSNumber *first, RACSequence *rest) {
+        return (first.unsignedIntegerValue >= 10 ? first : rest.head);
+    }];
+
+    XCTAssertEqualObjects(found, @10);
+    XCTAssertLessThan(evaluations, 100U);
+}
+
+- (void)testReleasingTenMillionElementChains {
+    XCTSkipUnless(RACSequenceTestsLongChainsEnabled(), @"Set RAC_LONG_SEQUENCE_TESTS to run");
+
+    [self performOnSecondaryThread:^{
+        [self verifyReleasingChainOfLength:10000000];
+    }];
+}
+
+- (void)testRightFoldsOverTenMillionElementSequences {
+    XCTSkipUnless(RACSequenceTestsLongChainsEnabled(), @"Set RAC_LONG_SEQUENCE_TESTS to run");
+
+    [self performOnSecondaryThread:^{
+        [self verifyRightFoldOfLength:10000000];
+    }];
+}
+
+#pragma mark Prefetching
+
+- (void)testPrefetchingPreservesOrder {
+    RACSequence *sequence = [RACSequenceTestsNumbers(1000).rac_sequence prefetch:16 onScheduler:[RACScheduler scheduler]];
+
+    XCTAssertEqualObjects(sequence.array, RACSequenceTestsNumbers(1000));
+    XCTAssertEqualObjects([RACSequence.empty prefetch:16 onScheduler:[RACScheduler scheduler]].array, @[]);
+}
+
+- (void)testPrefetchingBeginsImmediatelyOnTheScheduler {
+    RACScheduler *scheduler = [RACScheduler scheduler];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"values evaluated ahead of time"];
+
+    RACSequence *sequence = [[RACSequenceTestsNumbers(3).rac_sequence map:^(NSNumber *x) {
+        XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+        if (x.integerValue == 2) [expectation fulfill];
+
+        return x;
+    }] prefetch:3 onScheduler:scheduler];
+
+    // Nothing has accessed the sequence yet.
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqualObjects(sequence.array, (@[ @0, @1, @2 ]));
+}
+
+- (void)testPrefetchingPausesWhenTheBufferIsFull {
+    RACTestScheduler *scheduler = [[RACTestScheduler alloc] init];
+
+    __block NSUInteger evaluations = 0;
+    RACSequence *sequence = [[RACSequenceTestsNaturals(0) map:^(NSNumber *x) {
+        evaluations++;
+        return x;
+    }] prefetch:4 onScheduler:scheduler];
+
+    XCTAssertEqual(evaluations, 0U);
+
+    [scheduler step];
+    XCTAssertEqual(evaluations, 4U);
+
+    // Evaluation only resumes once half of the buffer has been taken.
+    XCTAssertEqualObjects(sequence.head, @0);
+    [scheduler stepAll];
+    XCTAssertEqual(evaluations, 4U);
+
+    XCTAssertEqualObjects(sequence.tail.head, @1);
+    [scheduler stepAll];
+    XCTAssertEqual(evaluations, 6U);
+
+    XCTAssertEqualObjects(sequence.tail.tail.head, @2);
+    XCTAssertEqualObjects(sequence.tail.tail.tail.head, @3);
+    XCTAssertEqual(evaluations, 6U);
+}
+
+#pragma mark String Components
+
+- (void)testLineSequences {
+    NSString *string = @"first\r\nsecond\n\nfourth\u2028fifth\n";
+    XCTAssertEqualObjects(string.rac_lineSequence.array, (@[ @"first", @"second", @"", @"fourth", @"fifth" ]));
+
+    XCTAssertEqualObjects(@"no terminator".rac_lineSequence.array, @[ @"no terminator" ]);
+    XCTAssertEqualObjects(@"\n".rac_lineSequence.array, @[ @"" ]);
+    XCTAssertEqualObjects(@"".rac_lineSequence.array, @[]);
+}
+
+- (void)testTokenSequences {
+    NSCharacterSet *separators = NSCharacterSet.whitespaceAndNewlineCharacterSet;
+
+    XCTAssertEqualObjects([@"  the quick\tbrown\n\nfox " rac_tokenSequenceWithSeparators:separators].array, (@[ @"the", @"quick", @"brown", @"fox" ]));
+    XCTAssertEqualObjects([@"   " rac_tokenSequenceWithSeparators:separators].array, @[]);
+    XCTAssertEqualObjects([@"a,b,,c" rac_tokenSequenceWithSeparators:[NSCharacterSet characterSetWithCharactersInString:@","]].array, (@[ @"a", @"b", @"c" ]));
+}
+
+- (void)testStringComponentsAreFoundLazily {
+    NSMutableString *string = [NSMutableString string];
+    for (NSUInteger i = 0; i < 10000; i++) {
+        [string appendFormat:@"line %lu\n", (unsigned long)i];
+    }
+
+    RACSequence *lines = string.rac_lineSequence;
+    XCTAssertEqualObjects([lines take:2].array, (@[ @"line 0", @"line 1" ]));
+    XCTAssertEqualObjects(lines.tail.tail.head, @"line 2");
+    XCTAssertEqual(RACSequenceTestsEnumerate(lines).count, 10000U);
+}
+
+- (void)testStringSequencesCopyTheReceiver {
+    NSMutableString *string = [NSMutableString stringWithString:@"a b\nc"];
+
+    RACSequence *characters = string.rac_sequence;
+    RACSequence *lines = string.rac_lineSequence;
+    RACSequence *tokens = [string rac_tokenSequenceWithSeparators:NSCharacterSet.whitespaceAndNewlineCharacterSet];
+
+    [string setString:@"changed"];
+
+    XCTAssertEqualObjects(characters.array, (@[ @"a", @" ", @"b", @"\n", @"c" ]));
+    XCTAssertEqualObjects(lines.array, (@[ @"a b", @"c" ]));
+    XCTAssertEqualObjects(tokens.array, (@[ @"a", @"b", @"c" ]));
+}
+
+- (void)testStringSequencesShareCommonCharacters {
+    RACSequence *sequence = @"aXa".rac_sequence;
+    XCTAssertEqual(sequence.head, sequence.tail.tail.head);
+
+    NSArray *characters = RACSequenceTestsEnumerate(@"\u00e9t\u00e9".rac_sequence);
+    XCTAssertEqualObjects(characters, (@[ @"\u00e9", @"t", @"\u00e9" ]));
+    XCTAssertEqual(characters.firstObject, characters.lastObject);
+}
+
+#pragma mark Sorting
+
+- (void)testSortedWithComparator {
+    NSMutableArray *shuffled = [RACSequenceTestsNumbers(10000) mutableCopy];
+    for (NSUInteger i = shuffled.count - 1; i > 0; i--) {
+        [shuffled exchangeObjectAtIndex:i withObjectAtIndex:arc4random_uniform((uint32_t)i + 1)];
+    }
+
+    RACSequence *sorted = [shuffled.rac_sequence sortedWithComparator:^(NSNumber *first, NSNumber *second) {
+        return [first compare:second];
+    }];
+
+    XCTAssertEqualObjects(sorted.array, RACSequenceTestsNumbers(10000));
+}
+
+- (void)testSortingIsStable {
+    // Sorting by the tens digit keeps the units in their original order.
+    NSMutableArray *numbers = [NSMutableArray array];
+    for (NSUInteger units = 0; units < 10; units++) {
+        for (NSUInteger tens = 10; tens > 0; tens--) {
+            [numbers addObject:@((tens - 1) * 10 + units)];
+        }
+    }
+
+    NSArray *byComparator = [numbers.rac_sequence sortedWithComparator:^(NSNumber *first, NSNumber *second) {
+        return [@(first.integerValue / 10) compare:@(second.integerValue / 10)];
+    }].array;
+
+    NSArray *byKey = [numbers.rac_sequence sortedByKey:^(NSNumber *x) {
+        return @(x.integerValue / 10);
+    }].array;
+
+    XCTAssertEqualObjects(byComparator, RACSequenceTestsNumbers(100));
+    XCTAssertEqualObjects(byKey, RACSequenceTestsNumbers(100));
+}
+
+- (void)testSortedByKeyComputesEachKeyOnce {
+    NSArray *strings = @[ @"ccc", @"a", @"bb", @"", @"dddd" ];
+
+    __block int32_t keys = 0;
+    RACSequence *sorted = [strings.rac_sequence sortedByKey:^(NSString *string) {
+        OSAtomicIncrement32(&keys);
+        return @(string.length);
+    }];
+
+    XCTAssertEqualObjects(sorted.array, (@[ @"", @"a", @"bb", @"ccc", @"dddd" ]));
+    XCTAssertEqual(keys, 5);
+}
+
+- (void)testSortingPreservesEagerness {
+    RACSequence *eager = @[ @2, @1 ].rac_sequence.eagerSequence;
+
+    XCTAssertTrue([[eager sortedByKey:^(id x) { return x; }] isKindOfClass:eager.class]);
+    XCTAssertFalse([[@[ @2, @1 ].rac_sequence sortedByKey:^(id x) { return x; }] isKindOfClass:eager.class]);
+}
+
+- (void)testMergeSortedWith {
+    NSComparator compare = ^(NSNumber *first, NSNumber *second) {
+        return [first compare:second];
+    };
+
+    RACSequence *evens = @[ @0, @2, @4, @6 ].rac_sequence;
+    RACSequence *odds = @[ @1, @3, @5 ].rac_sequence;
+
+    XCTAssertEqualObjects([evens mergeSortedWith:odds comparator:compare].array, (@[ @0, @1, @2, @3, @4, @5, @6 ]));
+    XCTAssertEqualObjects([evens mergeSortedWith:RACSequence.empty comparator:compare].array, (@[ @0, @2, @4, @6 ]));
+    XCTAssertEqualObjects([RACSequence.empty mergeSortedWith:odds comparator:compare].array, (@[ @1, @3, @5 ]));
+}
+
+- (void)testMergeSortedWithPrefersTheReceiverForEqualValues {
+    RACSequence *first = @[ @"a1", @"b1" ].rac_sequence;
+    RACSequence *second = @[ @"a2", @"b2" ].rac_sequence;
+
+    RACSequence *merged = [first mergeSortedWith:second comparator:^(NSString *x, NSString *y) {
+        return [[x substringToIndex:1] compare:[y substringToIndex:1]];
+    }];
+
+    XCTAssertEqualObjects(merged.array, (@[ @"a1", @"a2", @"b1", @"b2" ]));
+}
+
+- (void)testMergeSortedWithIsLazy {
+    RACSequence *multiplesOfThree = [RACSequenceTestsNaturals(0) map:^(NSNumber *x) {
+        return @(x.integerValue * 3);
+    }];
+
+    RACSequence *multiplesOfFive = [RACSequenceTestsNaturals(0) map:^(NSNumber *x) {
+        return @(x.integerValue * 5);
+    }];
+
+    RACSequence *merged = [multiplesOfThree mergeSortedWith:multiplesOfFive comparator:^(NSNumber *first, NSNumber *second) {
+        return [first compare:second];
+    }];
+
+    XCTAssertEqualObjects([merged take:8].array, (@[ @0, @0, @3, @5, @6, @9, @10, @12 ]));
+}
+
+@end
@@ -0,0 +1,126 @@
+//
+//  RACShardedSchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "RACShardedScheduler.h"
+
+@interface RACShardedSchedulerTests : XCTestCase
+
+// Shared by every test, since shard threads are never torn down.
+@property (class, nonatomic, strong, readonly) RACShardedScheduler *scheduler;
+
+@end
+
+@implementation RACShardedSchedulerTests
+
++ (RACShardedScheduler *)scheduler {
+    static RACShardedScheduler *scheduler = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        scheduler = [[RACShardedScheduler alloc] initWithName:@"RACShardedSchedulerTests" shardCount:3];
+    });
+
+    return scheduler;
+}
+
+- (void)testShards {
+    RACShardedScheduler *scheduler = self.class.scheduler;
+    XCTAssertEqual(scheduler.shardCount, 3U);
+    XCTAssertEqual(scheduler.shardIndex, 0U);
+    XCTAssertEqual([scheduler schedulerForShard:0], scheduler);
+
+    for (NSUInteger i = 0; i < 3; i++) {
+        RACShardedScheduler *shard = [scheduler schedulerForShard:i];
+        XCTAssertEqual(shard.shardIndex, i);
+        XCTAssertEqual(shard.shardCount, 3U);
+        XCTAssertEqual([shard schedulerForShard:0], scheduler);
+    }
+}
+
+- (void)testEqualKeysMapToTheSameShard {
+    RACShardedScheduler *scheduler = self.class.scheduler;
+
+    for (NSUInteger i = 0; i < 100; i++) {
+        NSString *key = [NSString stringWithFormat:@"key-%lu", (unsigned long)i];
+        NSMutableString *equalKey = [key mutableCopy];
+
+        RACShardedScheduler *shard = [scheduler schedulerForKey:key];
+        XCTAssertEqual([scheduler schedulerForKey:equalKey], shard);
+        XCTAssertEqual([[scheduler schedulerForShard:2] schedulerForKey:key], shard);
+    }
+}
+
+- (void)testKeysAreSpreadAcrossShards {
+    RACShardedScheduler *scheduler = self.class.scheduler;
+
+    NSMutableSet *shards = [NSMutableSet set];
+    for (NSUInteger i = 0; i < 100; i++) {
+        [shards addObject:[scheduler schedulerForKey:@(i)]];
+    }
+
+    XCTAssertEqual(shards.count, 3U);
+}
+
+- (void)testBlocksExecuteInOrderOnTheShardThread {
+    RACShardedScheduler *shard = [self.class.scheduler schedulerForShard:1];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"all blocks executed"];
+
+    const NSUInteger count = 100;
+    NSMutableArray *order = [NSMutableArray arrayWithCapacity:count];
+    NSMutableSet *threads = [NSMutableSet set];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        [shard schedule:^{
+            XCTAssertEqual(RACScheduler.currentScheduler, shard);
+            XCTAssertEqualObjects(NSThread.currentThread.name, @"RACShardedSchedulerTests.shard-1");
+
+            [order addObject:@(i)];
+            [threads addObject:[NSValue valueWithNonretainedObject:NSThread.currentThread]];
+            if (i == count - 1) [expectation fulfill];
+        }];
+    }
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        XCTAssertEqualObjects(order[i], @(i));
+    }
+
+    XCTAssertEqual(threads.count, 1U);
+}
+
+- (void)testTimersExecuteOnTheShardThread {
+    RACShardedScheduler *shard = [self.class.scheduler schedulerForShard:2];
+    XCTestExpectation *delayed = [self expectationWithDescription:@"delayed block executed"];
+    XCTestExpectation *repeated = [self expectationWithDescription:@"repeating block executed three times"];
+
+    [[shard after:[NSDate dateWithTimeIntervalSinceNow:0.01] schedule:^{
+        XCTFail(@"Disposed block should not execute");
+    }] dispose];
+
+    [shard after:[NSDate dateWithTimeIntervalSinceNow:0.02] schedule:^{
+        XCTAssertEqualObjects(NSThread.currentThread.name, @"RACShardedSchedulerTests.shard-2");
+        [delayed fulfill];
+    }];
+
+    __block NSUInteger count = 0;
+    __block RACDisposable *disposable = nil;
+    disposable = [shard after:[NSDate date] repeatingEvery:0.01 withLeeway:0 schedule:^{
+        XCTAssertEqual(RACScheduler.currentScheduler, shard);
+
+        if (++count == 3) {
+            [disposable dispose];
+            [repeated fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+@end
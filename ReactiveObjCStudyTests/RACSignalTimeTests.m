@@ -0,0 +1,327 @@
+//
+//  RACSignalTimeTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "RACSharedTimer.h"
+
+@interface RACSignalTimeTests : XCTestCase
+
+@end
+
+@implementation RACSignalTimeTests
+
+#pragma mark Monotonic Clock
+
+- (void)testMonotonicTimeAdvances {
+    uint64_t start = RACMonotonicTime();
+    [NSThread sleepForTimeInterval:0.01];
+    uint64_t end = RACMonotonicTime();
+
+    XCTAssertGreaterThanOrEqual(end - start, 10 * NSEC_PER_MSEC);
+}
+
+- (void)testAfterNanoseconds {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"block executed"];
+    RACScheduler *scheduler = [RACScheduler scheduler];
+
+    uint64_t start = RACMonotonicTime();
+    [scheduler afterNanoseconds:20 * NSEC_PER_MSEC schedule:^{
+        XCTAssertGreaterThanOrEqual(RACMonotonicTime() - start, 20 * NSEC_PER_MSEC);
+        XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+        [expectation fulfill];
+    }];
+
+    [[scheduler afterNanoseconds:10 * NSEC_PER_MSEC schedule:^{
+        XCTFail(@"Disposed block should not execute");
+    }] dispose];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testAfterNanosecondsRepeating {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"block executed three times"];
+
+    uint64_t start = RACMonotonicTime();
+    __block NSUInteger count = 0;
+    __block RACDisposable *disposable = nil;
+    disposable = [[RACScheduler scheduler] afterNanoseconds:10 * NSEC_PER_MSEC repeatingEveryNanoseconds:10 * NSEC_PER_MSEC withLeewayNanoseconds:0 schedule:^{
+        if (++count == 3) {
+            XCTAssertGreaterThanOrEqual(RACMonotonicTime() - start, 30 * NSEC_PER_MSEC);
+            [disposable dispose];
+            [expectation fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testTicksWithInterval {
+    RACTestScheduler *scheduler = [[RACTestScheduler alloc] init];
+
+    NSMutableArray *ticks = [NSMutableArray array];
+    RACDisposable *disposable = [[RACSignal ticksWithInterval:1 onScheduler:scheduler withLeeway:0] subscribeNext:^(NSNumber *tick) {
+        [ticks addObject:tick];
+    }];
+
+    [scheduler advanceBy:NSEC_PER_SEC / 2];
+    XCTAssertEqualObjects(ticks, @[]);
+
+    [scheduler advanceBy:3 * NSEC_PER_SEC];
+    XCTAssertEqualObjects(ticks, (@[ @1, @2, @3 ]));
+
+    [disposable dispose];
+    [scheduler advanceBy:3 * NSEC_PER_SEC];
+    XCTAssertEqual(ticks.count, 3U);
+}
+
+- (void)testTimestamp {
+    RACSubject *subject = [RACSubject subject];
+
+    NSMutableArray<RACTwoTuple *> *values = [NSMutableArray array];
+    [[subject timestamp] subscribeNext:^(RACTwoTuple *x) {
+        [values addObject:x];
+    }];
+
+    uint64_t start = RACMonotonicTime();
+    [subject sendNext:@"a"];
+    [NSThread sleepForTimeInterval:0.01];
+    [subject sendNext:@"b"];
+    uint64_t end = RACMonotonicTime();
+
+    XCTAssertEqual(values.count, 2U);
+    XCTAssertEqualObjects(values[0].first, @"a");
+    XCTAssertEqualObjects(values[1].first, @"b");
+
+    uint64_t first = [values[0].second unsignedLongLongValue];
+    uint64_t second = [values[1].second unsignedLongLongValue];
+    XCTAssertGreaterThanOrEqual(first, start);
+    XCTAssertGreaterThanOrEqual(second - first, 10 * NSEC_PER_MSEC);
+    XCTAssertLessThanOrEqual(second, end);
+}
+
+- (void)testTimeInterval {
+    RACSubject *subject = [RACSubject subject];
+
+    NSMutableArray<RACTwoTuple *> *values = [NSMutableArray array];
+    [[subject timeInterval] subscribeNext:^(RACTwoTuple *x) {
+        [values addObject:x];
+    }];
+
+    [NSThread sleepForTimeInterval:0.01];
+    [subject sendNext:@"a"];
+    [NSThread sleepForTimeInterval:0.02];
+    [subject sendNext:@"b"];
+
+    XCTAssertEqual(values.count, 2U);
+    XCTAssertEqualObjects(values[0].first, @"a");
+    XCTAssertGreaterThanOrEqual([values[0].second doubleValue], 0.01);
+    XCTAssertEqualObjects(values[1].first, @"b");
+    XCTAssertGreaterThanOrEqual([values[1].second doubleValue], 0.02);
+}
+
+#pragma mark Shared Timers
+
+- (void)testFirstTickDatesAreAligned {
+    for (NSTimeInterval interval = 0.25; interval <= 64; interval *= 2) {
+        NSTimeInterval now = NSDate.timeIntervalSinceReferenceDate;
+        NSTimeInterval first = [RACSharedTimer firstTickDateWithInterval:interval].timeIntervalSinceReferenceDate;
+
+        XCTAssertEqualWithAccuracy(fmod(first, interval), 0, 1e-6);
+        XCTAssertGreaterThanOrEqual(first - now, interval / 2 - 1e-3);
+        XCTAssertLessThanOrEqual(first - now, interval * 1.5 + 1e-3);
+    }
+}
+
+- (void)testSharedTimersDeliverOneDatePerTickToEveryObserver {
+    RACScheduler *scheduler = [RACScheduler scheduler];
+    XCTestExpectation *firstTicked = [self expectationWithDescription:@"first observer ticked"];
+    XCTestExpectation *secondTicked = [self expectationWithDescription:@"second observer ticked"];
+
+    __block NSDate *firstDate = nil;
+    __block NSDate *secondDate = nil;
+
+    RACDisposable *first = [RACSharedTimer observeInterval:0.05 leeway:0 onScheduler:scheduler block:^(NSDate *date) {
+        XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+
+        if (firstDate == nil) {
+            firstDate = date;
+            [firstTicked fulfill];
+        }
+    }];
+
+    RACDisposable *second = [RACSharedTimer observeInterval:0.05 leeway:0 onScheduler:scheduler block:^(NSDate *date) {
+        if (secondDate == nil) {
+            secondDate = date;
+            [secondTicked fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    XCTAssertEqual(firstDate, secondDate);
+
+    [first dispose];
+    [second dispose];
+}
+
+- (void)testDisposingOneSharedTimerObserverLeavesTheOthers {
+    RACScheduler *scheduler = [RACScheduler scheduler];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"remaining observer ticked twice"];
+
+    RACDisposable *disposed = [RACSharedTimer observeInterval:0.02 leeway:0 onScheduler:scheduler block:^(NSDate *date) {
+        XCTFail(@"Disposed observer should not be invoked");
+    }];
+
+    __block NSUInteger count = 0;
+    RACDisposable *remaining = [RACSharedTimer observeInterval:0.02 leeway:0 onScheduler:scheduler block:^(NSDate *date) {
+        if (++count == 2) [expectation fulfill];
+    }];
+
+    [disposed dispose];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    [remaining dispose];
+}
+
+- (void)testIntervalFirstTicksAfterTheInterval {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"ticked"];
+    NSDate *start = [NSDate date];
+    __block NSDate *firstDate = nil;
+
+    RACDisposable *disposable = [[[RACSignal interval:0.1 onScheduler:[RACScheduler scheduler] withLeeway:0] take:1] subscribeNext:^(NSDate *date) {
+        firstDate = date;
+        [expectation fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    // Unlike an aligned interval, the first tick is never early.
+    XCTAssertGreaterThanOrEqual([firstDate timeIntervalSinceDate:start], 0.1);
+
+    [disposable dispose];
+}
+
+- (void)testIntervalSharesTicksOnQueueSchedulers {
+    RACScheduler *scheduler = [RACScheduler scheduler];
+    RACSignal *signal = [RACSignal interval:0.05 onScheduler:scheduler withLeeway:0];
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"both subscribers ticked"];
+    NSMutableArray *firstDates = [NSMutableArray array];
+    __block NSDate *secondDate = nil;
+
+    void (^fulfillIfDone)(void) = ^{
+        if (firstDates.count == 2 && secondDate != nil) [expectation fulfill];
+    };
+
+    RACDisposable *first = [[signal take:2] subscribeNext:^(NSDate *date) {
+        @synchronized (firstDates) {
+            [firstDates addObject:date];
+            fulfillIfDone();
+        }
+    }];
+
+    [NSThread sleepForTimeInterval:0.01];
+    NSDate *joined = [NSDate date];
+
+    RACDisposable *second = [[signal take:1] subscribeNext:^(NSDate *date) {
+        @synchronized (firstDates) {
+            secondDate = date;
+            fulfillIfDone();
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    // The second subscriber joined after the timer started, so it skips the
+    // first tick, which is less than an interval away, and then shares the
+    // next one.
+    XCTAssertEqual(secondDate, firstDates[1]);
+    XCTAssertGreaterThanOrEqual([secondDate timeIntervalSinceDate:joined], 0.05);
+
+    [first dispose];
+    [second dispose];
+}
+
+- (void)testIntervalAndAlignedIntervalDoNotShareTimers {
+    RACScheduler *scheduler = [RACScheduler scheduler];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"both ticked"];
+    expectation.expectedFulfillmentCount = 2;
+
+    __block NSDate *unalignedDate = nil;
+    __block NSDate *alignedDate = nil;
+
+    RACDisposable *unaligned = [RACSharedTimer observeInterval:0.05 leeway:0 aligned:NO onScheduler:scheduler block:^(NSDate *date) {
+        if (unalignedDate == nil) {
+            unalignedDate = date;
+            [expectation fulfill];
+        }
+    }];
+
+    RACDisposable *aligned = [RACSharedTimer observeInterval:0.05 leeway:0 aligned:YES onScheduler:scheduler block:^(NSDate *date) {
+        if (alignedDate == nil) {
+            alignedDate = date;
+            [expectation fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertNotEqual(unalignedDate, alignedDate);
+
+    [unaligned dispose];
+    [aligned dispose];
+}
+
+- (void)testAlignedIntervalSharesTicksOnQueueSchedulers {
+    RACScheduler *scheduler = [RACScheduler scheduler];
+    RACSignal *signal = [RACSignal alignedInterval:0.05 onScheduler:scheduler withLeeway:0];
+
+    XCTestExpectation *expectation = [self expectationWithDescription:@"both subscribers ticked"];
+    NSMutableArray *dates = [NSMutableArray array];
+
+    void (^next)(NSDate *) = ^(NSDate *date) {
+        @synchronized (dates) {
+            [dates addObject:date];
+            if (dates.count == 2) [expectation fulfill];
+        }
+    };
+
+    RACDisposable *first = [[signal take:1] subscribeNext:next];
+    RACDisposable *second = [[signal take:1] subscribeNext:next];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertEqual(dates[0], dates[1]);
+
+    [first dispose];
+    [second dispose];
+}
+
+- (void)testAlignedIntervalOnOtherSchedulers {
+    RACTestScheduler *scheduler = [[RACTestScheduler alloc] init];
+
+    __block NSUInteger count = 0;
+    RACDisposable *disposable = [[RACSignal alignedInterval:1 onScheduler:scheduler withLeeway:0] subscribeNext:^(NSDate *date) {
+        count++;
+    }];
+
+    // The first tick is between half an interval and one and a half intervals
+    // away.
+    [scheduler advanceTo:NSEC_PER_SEC * 2 / 5];
+    XCTAssertEqual(count, 0U);
+
+    [scheduler advanceTo:NSEC_PER_SEC * 8 / 5];
+    XCTAssertGreaterThanOrEqual(count, 1U);
+
+    NSUInteger previousCount = count;
+    [scheduler advanceBy:NSEC_PER_SEC * 10];
+    XCTAssertEqual(count, previousCount + 10);
+
+    [disposable dispose];
+}
+
+@end
@@ -0,0 +1,272 @@
+//
+//  RACSubscriptionSchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+#import "RACTrampolineScheduler.h"
+
+@interface RACSubscriptionSchedulerTests : XCTestCase
+
+@end
+
+@implementation RACSubscriptionSchedulerTests
+
+- (void)tearDown {
+    RACSignal.defaultSubscriptionPolicy = RACSubscriptionPolicyBackground;
+}
+
+// Runs the block on a GCD queue, where there's no current scheduler, and waits
+// for it to finish.
+- (void)performWithoutCurrentScheduler:(void (^)(void))block {
+    XCTestExpectation *expectation = [self expectationWithDescription:@"block finished"];
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        XCTAssertNil(RACScheduler.currentScheduler);
+        block();
+        [expectation fulfill];
+    });
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testSynchronousPolicySubscribesOnTheCallingThread {
+    [self performWithoutCurrentScheduler:^{
+        NSThread *callingThread = NSThread.currentThread;
+        __block NSThread *subscriptionThread = nil;
+
+        RACSignal *signal = [[RACSignal createSignal:^RACDisposable *(id<RACSubscriber> subscriber) {
+            subscriptionThread = NSThread.currentThread;
+            [subscriber sendNext:@1];
+            [subscriber sendCompleted];
+            return nil;
+        }] subscriptionPolicy:RACSubscriptionPolicySynchronous];
+
+        __block BOOL completed = NO;
+        [signal subscribeCompleted:^{
+            completed = YES;
+        }];
+
+        XCTAssertTrue(completed);
+        XCTAssertEqual(subscriptionThread, callingThread);
+    }];
+}
+
+- (void)testSynchronousPolicyIsInheritedByInnerSubscriptions {
+    [self performWithoutCurrentScheduler:^{
+        RACSignal *signal = [[[RACSignal return:@1] concat:[RACSignal return:@2]] subscriptionPolicy:RACSubscriptionPolicySynchronous];
+
+        NSMutableArray *values = [NSMutableArray array];
+        [signal subscribeNext:^(id x) {
+            [values addObject:x];
+        }];
+
+        XCTAssertEqualObjects(values, (@[ @1, @2 ]));
+    }];
+}
+
+- (void)testDefaultSubscriptionPolicy {
+    RACSignal.defaultSubscriptionPolicy = RACSubscriptionPolicySynchronous;
+
+    [self performWithoutCurrentScheduler:^{
+        __block id value = nil;
+        [[RACSignal return:@1] subscribeNext:^(id x) {
+            value = x;
+        }];
+
+        XCTAssertEqualObjects(value, @1);
+    }];
+}
+
+- (void)testStatistics {
+    [RACSignal resetSubscriptionStatistics];
+    [[RACSignal empty] subscribeCompleted:^{}];
+
+    RACSubscriptionStatistics statistics = RACSignal.subscriptionStatistics;
+    XCTAssertEqual(statistics.immediate, 1ULL);
+    XCTAssertEqual(statistics.synchronous, 0ULL);
+    XCTAssertEqual(statistics.hopped, 0ULL);
+
+    [self performWithoutCurrentScheduler:^{
+        [RACSignal resetSubscriptionStatistics];
+        [[[RACSignal empty] subscriptionPolicy:RACSubscriptionPolicySynchronous] subscribeCompleted:^{}];
+
+        RACSubscriptionStatistics statistics = RACSignal.subscriptionStatistics;
+        XCTAssertEqual(statistics.immediate, 0ULL);
+        XCTAssertEqual(statistics.synchronous, 2ULL);
+        XCTAssertEqual(statistics.hopped, 0ULL);
+    }];
+}
+
+- (void)testNestedBlockingOperatorsDoNotDeadlock {
+    // Each level subscribes to the next with -first, which blocks until a
+    // value arrives, so it has to execute the subscriptions that get
+    // trampolined once they nest deeper than the limit.
+    __block RACSignal * (^nested)(NSUInteger depth) = nil;
+    RACSignal * (^signalWithDepth)(NSUInteger depth) = ^(NSUInteger depth) {
+        if (depth == 0) return [RACSignal return:@0];
+
+        return [RACSignal createSignal:^RACDisposable *(id<RACSubscriber> subscriber) {
+            NSNumber *inner = [nested(depth - 1) first];
+            [subscriber sendNext:@(inner.unsignedIntegerValue + 1)];
+            [subscriber sendCompleted];
+            return nil;
+        }];
+    };
+    nested = signalWithDepth;
+
+    XCTAssertNotNil(RACScheduler.currentScheduler);
+    XCTAssertEqualObjects([signalWithDepth(RACTrampolineSubscriptionDepthLimit * 2) first], @(RACTrampolineSubscriptionDepthLimit * 2));
+
+    nested = nil;
+}
+
+- (void)testDeepSynchronousChainsDoNotOverflowTheStack {
+    [self performWithoutCurrentScheduler:^{
+        const NSUInteger count = 10000;
+
+        RACSignal *signal = [RACSignal return:@0];
+        for (NSUInteger i = 1; i < count; i++) {
+            signal = [signal concat:[RACSignal return:@(i)]];
+        }
+
+        __block NSUInteger received = 0;
+        __block BOOL completed = NO;
+        [[signal subscriptionPolicy:RACSubscriptionPolicySynchronous] subscribeNext:^(NSNumber *x) {
+            XCTAssertEqual(x.unsignedIntegerValue, received);
+            received++;
+        } completed:^{
+            completed = YES;
+        }];
+
+        XCTAssertEqual(received, count);
+        XCTAssertTrue(completed);
+    }];
+}
+
+- (void)testDeepChainsOnTheImmediateSchedulerDoNotOverflowTheStack {
+    const NSUInteger count = 100000;
+
+    RACSignal *signal = [RACSignal return:@0];
+    for (NSUInteger i = 1; i < count; i++) {
+        signal = [signal concat:[RACSignal return:@(i)]];
+    }
+
+    __block NSUInteger received = 0;
+    __block BOOL inOrder = YES;
+    __block BOOL completed = NO;
+
+    // The main thread scheduler is still current here, so every subscription
+    // runs on this thread as soon as it's made.
+    [RACScheduler.immediateScheduler schedule:^{
+        XCTAssertNotNil(RACScheduler.currentScheduler);
+
+        [signal subscribeNext:^(NSNumber *x) {
+            if (x.unsignedIntegerValue != received) inOrder = NO;
+            received++;
+        } completed:^{
+            completed = YES;
+        }];
+    }];
+
+    XCTAssertEqual(received, count);
+    XCTAssertTrue(inOrder);
+    XCTAssertTrue(completed);
+}
+
+- (void)testRecursiveSchedulingOnTheImmediateScheduler {
+    __block NSUInteger iterations = 0;
+
+    [RACScheduler.immediateScheduler scheduleRecursiveBlock:^(void (^reschedule)(void)) {
+        if (++iterations < 100000) reschedule();
+    }];
+
+    XCTAssertEqual(iterations, 100000U);
+}
+
+- (void)testDisposingConcatenatedSignals {
+    RACSubject *subject = [RACSubject subject];
+    NSMutableArray *values = [NSMutableArray array];
+
+    RACSignal *signal = [[[RACSignal return:@1] concat:subject] concat:[RACSignal return:@3]];
+    RACDisposable *disposable = [signal subscribeNext:^(id x) {
+        [values addObject:x];
+    }];
+
+    [subject sendNext:@2];
+    [disposable dispose];
+    [subject sendNext:@4];
+    [subject sendCompleted];
+
+    XCTAssertEqualObjects(values, (@[ @1, @2 ]));
+}
+
+- (void)testConcatenatingOntoTheMiddleOfAChain {
+    RACSignal *first = [[RACSignal return:@1] concat:[RACSignal return:@2]];
+    RACSignal *signal = [first concat:[RACSignal return:@3]];
+    RACSignal *branch = [first concat:[RACSignal return:@4]];
+
+    XCTAssertEqualObjects([first toArray], (@[ @1, @2 ]));
+    XCTAssertEqualObjects([signal toArray], (@[ @1, @2, @3 ]));
+    XCTAssertEqualObjects([branch toArray], (@[ @1, @2, @4 ]));
+    XCTAssertEqualObjects([[signal concat:[RACSignal empty]] toArray], (@[ @1, @2, @3 ]));
+}
+
+- (void)testSynchronousDepthIsRestoredAfterAnException {
+    [self performWithoutCurrentScheduler:^{
+        RACSignal *signal = [[RACSignal createSignal:^RACDisposable *(id<RACSubscriber> subscriber) {
+            @throw [NSException exceptionWithName:@"RACSubscriptionSchedulerTestsException" reason:nil userInfo:nil];
+        }] subscriptionPolicy:RACSubscriptionPolicySynchronous];
+
+        XCTAssertThrows([signal subscribeCompleted:^{}]);
+
+        // If the synchronous depth had leaked, this would inherit the
+        // synchronous policy instead of hopping.
+        [RACSignal resetSubscriptionStatistics];
+        [[RACSignal empty] subscribeCompleted:^{}];
+
+        RACSubscriptionStatistics statistics = RACSignal.subscriptionStatistics;
+        XCTAssertEqual(statistics.synchronous, 0ULL);
+        XCTAssertEqual(statistics.hopped, 1ULL);
+    }];
+}
+
+- (void)testTrampolineSchedulerRunsNestedBlocksAfterTheOuterBlock {
+    NSMutableArray *events = [NSMutableArray array];
+
+    [RACScheduler.trampolineScheduler schedule:^{
+        [events addObject:@"outer began"];
+
+        [RACScheduler.trampolineScheduler schedule:^{
+            [events addObject:@"first inner"];
+        }];
+
+        [RACScheduler.trampolineScheduler schedule:^{
+            [events addObject:@"second inner"];
+        }];
+
+        [events addObject:@"outer ended"];
+    }];
+
+    XCTAssertEqualObjects(events, (@[ @"outer began", @"outer ended", @"first inner", @"second inner" ]));
+}
+
+- (void)testTrampolineSchedulerSkipsDisposedBlocks {
+    __block BOOL executed = NO;
+
+    [RACScheduler.trampolineScheduler schedule:^{
+        RACDisposable *disposable = [RACScheduler.trampolineScheduler schedule:^{
+            executed = YES;
+        }];
+
+        [disposable dispose];
+    }];
+
+    XCTAssertFalse(executed);
+}
+
+@end
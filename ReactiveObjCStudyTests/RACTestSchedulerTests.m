@@ -0,0 +1,164 @@
+//
+//  RACTestSchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+
+@interface RACTestSchedulerTests : XCTestCase
+
+@property (nonatomic, strong) RACTestScheduler *scheduler;
+
+@end
+
+@implementation RACTestSchedulerTests
+
+- (void)setUp {
+    self.scheduler = [[RACTestScheduler alloc] init];
+}
+
+- (void)testStepExecutesBlocksInOrder {
+    NSMutableArray *order = [NSMutableArray array];
+
+    [self.scheduler afterNanoseconds:20 schedule:^{
+        [order addObject:@"later"];
+    }];
+
+    [self.scheduler schedule:^{
+        [order addObject:@"first"];
+    }];
+
+    [self.scheduler schedule:^{
+        [order addObject:@"second"];
+    }];
+
+    [self.scheduler step];
+    XCTAssertEqualObjects(order, @[ @"first" ]);
+    XCTAssertEqual(self.scheduler.currentTime, 0ULL);
+
+    [self.scheduler stepAll];
+    XCTAssertEqualObjects(order, (@[ @"first", @"second", @"later" ]));
+    XCTAssertEqual(self.scheduler.currentTime, 20ULL);
+}
+
+- (void)testStepSkipsDisposedBlocksWithoutCountingThem {
+    NSMutableArray *order = [NSMutableArray array];
+
+    [[self.scheduler schedule:^{
+        [order addObject:@"disposed"];
+    }] dispose];
+
+    [self.scheduler schedule:^{
+        [order addObject:@"first"];
+    }];
+
+    [[self.scheduler schedule:^{
+        [order addObject:@"disposed"];
+    }] dispose];
+
+    [self.scheduler schedule:^{
+        [order addObject:@"second"];
+    }];
+
+    [self.scheduler schedule:^{
+        [order addObject:@"third"];
+    }];
+
+    [self.scheduler step:2];
+    XCTAssertEqualObjects(order, (@[ @"first", @"second" ]));
+}
+
+- (void)testDisposedBlocksDoNotAdvanceTheClock {
+    [[self.scheduler afterNanoseconds:100 schedule:^{}] dispose];
+    [self.scheduler afterNanoseconds:200 schedule:^{}];
+
+    [self.scheduler step];
+    XCTAssertEqual(self.scheduler.currentTime, 200ULL);
+
+    [[self.scheduler afterNanoseconds:100 schedule:^{}] dispose];
+    [self.scheduler step];
+    XCTAssertEqual(self.scheduler.currentTime, 200ULL);
+}
+
+- (void)testAdvance {
+    NSMutableArray *times = [NSMutableArray array];
+
+    for (uint64_t delay = 10; delay <= 50; delay += 10) {
+        [self.scheduler afterNanoseconds:delay schedule:^{
+            [times addObject:@(self.scheduler.currentTime)];
+        }];
+    }
+
+    [self.scheduler advanceBy:25];
+    XCTAssertEqualObjects(times, (@[ @10, @20 ]));
+    XCTAssertEqual(self.scheduler.currentTime, 25ULL);
+
+    [self.scheduler advanceTo:40];
+    XCTAssertEqualObjects(times, (@[ @10, @20, @30, @40 ]));
+    XCTAssertEqual(self.scheduler.currentTime, 40ULL);
+
+    [self.scheduler advanceTo:0];
+    XCTAssertEqual(times.count, 4U);
+    XCTAssertEqual(self.scheduler.currentTime, 40ULL);
+
+    [self.scheduler advanceBy:UINT64_MAX];
+    XCTAssertEqual(times.count, 5U);
+}
+
+- (void)testBlocksScheduledByOtherBlocksAreDueRelativeToTheirTime {
+    __block uint64_t innerTime = 0;
+
+    [self.scheduler afterNanoseconds:100 schedule:^{
+        [self.scheduler afterNanoseconds:50 schedule:^{
+            innerTime = self.scheduler.currentTime;
+        }];
+    }];
+
+    [self.scheduler advanceBy:1000];
+    XCTAssertEqual(innerTime, 150ULL);
+}
+
+- (void)testScheduleEvents {
+    NSMutableArray *events = [NSMutableArray array];
+
+    RACDisposable *disposable = [self.scheduler scheduleEvents:5 startingAt:100 spacing:10 block:^(NSUInteger index) {
+        [events addObject:@[ @(index), @(self.scheduler.currentTime) ]];
+    }];
+
+    [self.scheduler advanceTo:120];
+    XCTAssertEqualObjects(events, (@[ @[ @0, @100 ], @[ @1, @110 ], @[ @2, @120 ] ]));
+
+    [disposable dispose];
+    [self.scheduler stepAll];
+    XCTAssertEqual(events.count, 3U);
+}
+
+- (void)testSimulateEvents {
+    RACTestSchedulerSimulation simulation = [self.scheduler simulateEvents:1000 spacing:NSEC_PER_MSEC throughPipeline:^(RACSignal *input, RACTestScheduler *scheduler) {
+        return [input bufferWithTime:0.1 onScheduler:scheduler];
+    }];
+
+    XCTAssertEqual(simulation.inputCount, 1000U);
+    XCTAssertEqual(simulation.outputCount, 10U);
+    XCTAssertTrue(simulation.completed);
+    XCTAssertFalse(simulation.failed);
+    XCTAssertGreaterThanOrEqual(simulation.virtualDuration, 999 * NSEC_PER_MSEC);
+}
+
+- (void)testSimulateEventsPerformance {
+    [self measureBlock:^{
+        RACTestScheduler *scheduler = [[RACTestScheduler alloc] init];
+        RACTestSchedulerSimulation simulation = [scheduler simulateEvents:100000 spacing:NSEC_PER_MSEC throughPipeline:^(RACSignal *input, RACTestScheduler *scheduler) {
+            return [input throttle:0.01];
+        }];
+
+        XCTAssertEqual(simulation.inputCount, 100000U);
+        XCTAssertTrue(simulation.completed);
+    }];
+}
+
+@end
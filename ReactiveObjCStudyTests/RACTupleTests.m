@@ -0,0 +1,217 @@
+//
+//  RACTupleTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import "ReactiveObjC.h"
+
+// Returns an array of `count` signals, each sending its own index once.
+static NSArray<RACSignal *> *RACTupleTestsSignals(NSUInteger count) {
+    NSMutableArray *signals = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [signals addObject:[RACSignal return:@(i)]];
+    }
+
+    return signals;
+}
+
+// Returns an array of the NSNumbers from 0 up to, but not including, `count`.
+static NSArray<NSNumber *> *RACTupleTestsNumbers(NSUInteger count) {
+    NSMutableArray *numbers = [NSMutableArray arrayWithCapacity:count];
+    for (NSUInteger i = 0; i < count; i++) {
+        [numbers addObject:@(i)];
+    }
+
+    return numbers;
+}
+
+@interface RACTupleTests : XCTestCase
+
+@end
+
+@implementation RACTupleTests
+
+#pragma mark Hashing
+
+- (void)testHashDependsOnEveryObject {
+    XCTAssertNotEqual(RACTuplePack(@1, @2).hash, RACTuplePack(@1, @3).hash);
+    XCTAssertNotEqual(RACTuplePack(@1, @2).hash, RACTuplePack(@2, @1).hash);
+    XCTAssertNotEqual(RACTuplePack(@"a", @"b", @"c").hash, RACTuplePack(@"a", @"b", @"d").hash);
+
+    NSArray *six = RACTupleTestsNumbers(6);
+    NSMutableArray *otherSix = [six mutableCopy];
+    otherSix[5] = @6;
+    XCTAssertNotEqual([RACTuple tupleWithObjectsFromArray:six].hash, [RACTuple tupleWithObjectsFromArray:otherSix].hash);
+}
+
+- (void)testHashesAreWellDistributed {
+    NSMutableSet *hashes = [NSMutableSet set];
+    for (NSUInteger x = 0; x < 100; x++) {
+        for (NSUInteger y = 0; y < 100; y++) {
+            [hashes addObject:@(RACTuplePack(@(x), @(y)).hash)];
+        }
+    }
+
+    XCTAssertEqual(hashes.count, 10000U);
+}
+
+- (void)testEqualTuplesHaveEqualHashes {
+    RACTuple *packed = RACTuplePack(@1, nil, @"three");
+    RACTuple *fromArray = [RACTuple tupleWithObjectsFromArray:@[ @1, NSNull.null, @"three" ] convertNullsToNils:YES];
+    RACTuple *added = [RACTuplePack(@1, nil) tupleByAddingObject:[@"thr" stringByAppendingString:@"ee"]];
+
+    XCTAssertEqualObjects(packed, fromArray);
+    XCTAssertEqualObjects(packed, added);
+    XCTAssertEqual(packed.hash, fromArray.hash);
+    XCTAssertEqual(packed.hash, added.hash);
+
+    NSArray *numbers = RACTupleTestsNumbers(7);
+    XCTAssertEqual([RACTuple tupleWithObjectsFromArray:numbers].hash, [RACTuple tupleWithObjectsFromArray:[numbers copy]].hash);
+}
+
+- (void)testTuplesAsDictionaryKeys {
+    NSMutableDictionary *dictionary = [NSMutableDictionary dictionary];
+    for (NSUInteger x = 0; x < 10; x++) {
+        for (NSUInteger y = 0; y < 10; y++) {
+            dictionary[RACTuplePack(@(x), @(y))] = @(x * 10 + y);
+        }
+    }
+
+    XCTAssertEqual(dictionary.count, 100U);
+    XCTAssertEqualObjects(dictionary[RACTuplePack(@4, @2)], @42);
+    XCTAssertNil(dictionary[RACTuplePack(@4, @2, @0)]);
+}
+
+#pragma mark Equality
+
+- (void)testEqualityAcrossClasses {
+    RACTuple *packed = RACTuplePack(@1, @2);
+    RACTuple *generic = [RACTuple tupleWithObjectsFromArray:@[ @1, @2 ]];
+    RACTuple *fixed = [RACTwoTuple pack:@1 :@2];
+
+    XCTAssertTrue([generic isKindOfClass:RACTwoTuple.class]);
+    XCTAssertEqualObjects(packed, generic);
+    XCTAssertEqualObjects(generic, fixed);
+    XCTAssertEqualObjects(fixed, packed);
+
+    XCTAssertNotEqualObjects(packed, RACTuplePack(@1, @2, nil));
+    XCTAssertNotEqualObjects(RACTuplePack(@1, @2, nil), packed);
+    XCTAssertNotEqualObjects(packed, RACTuplePack(@1, nil));
+    XCTAssertNotEqualObjects(packed, (@[ @1, @2 ]));
+}
+
+- (void)testEqualityOfLargeTuples {
+    RACTuple *tuple = [RACTuple tupleWithObjectsFromArray:RACTupleTestsNumbers(10)];
+
+    XCTAssertEqual(tuple.count, 10U);
+    XCTAssertEqualObjects(tuple, [RACTuple tupleWithObjectsFromArray:RACTupleTestsNumbers(10)]);
+    XCTAssertNotEqualObjects(tuple, [RACTuple tupleWithObjectsFromArray:RACTupleTestsNumbers(11)]);
+}
+
+#pragma mark Packing
+
+- (void)testPackingNils {
+    RACTuple *tuple = RACTuplePack(nil, @2, nil);
+
+    XCTAssertEqual(tuple.count, 3U);
+    XCTAssertNil(tuple.first);
+    XCTAssertEqualObjects(tuple.second, @2);
+    XCTAssertNil(tuple.third);
+    XCTAssertEqualObjects(tuple.allObjects, (@[ NSNull.null, @2, NSNull.null ]));
+
+    RACTuple *large = RACTuplePack(@0, nil, @2, @3, @4, @5, nil);
+    XCTAssertEqual(large.count, 7U);
+    XCTAssertNil(large[1]);
+    XCTAssertNil(large.last);
+    XCTAssertEqualObjects(large[5], @5);
+}
+
+- (void)testPackingUsesFixedArityClasses {
+    XCTAssertTrue([RACTuplePack(@1) isKindOfClass:RACOneTuple.class]);
+    XCTAssertTrue([RACTuplePack(@1, @2) isKindOfClass:RACTwoTuple.class]);
+    XCTAssertTrue([RACTuplePack(@1, @2, @3) isKindOfClass:RACThreeTuple.class]);
+    XCTAssertTrue([RACTuplePack(@1, @2, @3, @4) isKindOfClass:RACFourTuple.class]);
+    XCTAssertTrue([RACTuplePack(@1, @2, @3, @4, @5) isKindOfClass:RACFiveTuple.class]);
+}
+
+#pragma mark Overflowing Fixed Arities
+
+- (void)testAddingObjectsBeyondFiveObjects {
+    RACTuple *tuple = [RACTuplePack(@0, @1, @2, @3, @4) tupleByAddingObject:@5];
+
+    XCTAssertFalse([tuple isKindOfClass:RACFiveTuple.class]);
+    XCTAssertEqual(tuple.count, 6U);
+    XCTAssertEqualObjects(tuple.allObjects, RACTupleTestsNumbers(6));
+
+    tuple = [tuple tupleByAddingObject:nil];
+    XCTAssertEqual(tuple.count, 7U);
+    XCTAssertNil(tuple.last);
+}
+
+- (void)testFixedArityClassesWithOtherCounts {
+    RACTuple *tuple = [RACTwoTuple tupleWithObjectsFromArray:@[ @"a", @"b", @"c" ]];
+
+    XCTAssertEqual(tuple.count, 3U);
+    XCTAssertEqualObjects(tuple.allObjects, (@[ @"a", @"b", @"c" ]));
+    XCTAssertEqualObjects(tuple, RACTuplePack(@"a", @"b", @"c"));
+
+    tuple = [RACFiveTuple tupleWithObjectsFromArray:RACTupleTestsNumbers(8)];
+    XCTAssertEqual(tuple.count, 8U);
+    XCTAssertEqualObjects(tuple.allObjects, RACTupleTestsNumbers(8));
+
+    tuple = [RACOneTuple tupleWithObjectsFromArray:@[ @"a", @"b" ]];
+    XCTAssertEqual(tuple.count, 2U);
+    XCTAssertEqualObjects(tuple.second, @"b");
+}
+
+- (void)testDecodingArchivesOfTheWrongSize {
+    NSError *error = nil;
+    NSData *data = [NSKeyedArchiver archivedDataWithRootObject:RACTuplePack(@1, @2, @3) requiringSecureCoding:NO error:&error];
+    XCTAssertNotNil(data, @"%@", error);
+
+    NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingFromData:data error:&error];
+    XCTAssertNotNil(unarchiver, @"%@", error);
+
+    unarchiver.requiresSecureCoding = NO;
+    [unarchiver setClass:RACTwoTuple.class forClassName:NSStringFromClass(RACThreeTuple.class)];
+
+    RACTuple *tuple = [unarchiver decodeObjectForKey:NSKeyedArchiveRootObjectKey];
+    [unarchiver finishDecoding];
+
+    XCTAssertEqual(tuple.count, 3U);
+    XCTAssertEqualObjects(tuple.allObjects, (@[ @1, @2, @3 ]));
+}
+
+#pragma mark Joining Signals
+
+- (void)testZippingManySignals {
+    for (NSUInteger count = 1; count <= 12; count++) {
+        RACTuple *tuple = [[RACSignal zip:RACTupleTestsSignals(count)] first];
+
+        XCTAssertEqual(tuple.count, count);
+        XCTAssertEqualObjects(tuple.allObjects, RACTupleTestsNumbers(count));
+    }
+}
+
+- (void)testCombiningManySignals {
+    for (NSUInteger count = 1; count <= 12; count++) {
+        RACTuple *tuple = [[RACSignal combineLatest:RACTupleTestsSignals(count)] first];
+
+        XCTAssertEqual(tuple.count, count);
+        XCTAssertEqualObjects(tuple.allObjects, RACTupleTestsNumbers(count));
+    }
+}
+
+- (void)testJoiningSignalsThatSendNil {
+    NSArray *signals = @[ [RACSignal return:nil], [RACSignal return:@1], [RACSignal return:nil] ];
+    RACTuple *tuple = [[RACSignal zip:signals] first];
+
+    XCTAssertEqualObjects(tuple, RACTuplePack(nil, @1, nil));
+    XCTAssertEqualObjects(tuple.allObjects, (@[ NSNull.null, @1, NSNull.null ]));
+}
+
+@end
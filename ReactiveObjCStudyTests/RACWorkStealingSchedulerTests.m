@@ -0,0 +1,143 @@
+//
+//  RACWorkStealingSchedulerTests.m
+//  ReactiveObjCStudyTests
+//
+//  Created by agent on 2026/10/18.
+//  Copyright © 2026 WoQi. All rights reserved.
+//
+
+#import <XCTest/XCTest.h>
+#import <libkern/OSAtomic.h>
+#import "ReactiveObjC.h"
+#import "RACWorkStealingScheduler.h"
+
+@interface RACWorkStealingSchedulerTests : XCTestCase
+
+// Shared by every test, since worker threads are never torn down.
+@property (class, nonatomic, strong, readonly) RACWorkStealingScheduler *scheduler;
+
+@end
+
+@implementation RACWorkStealingSchedulerTests
+
++ (RACWorkStealingScheduler *)scheduler {
+    static RACWorkStealingScheduler *scheduler = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        scheduler = [[RACWorkStealingScheduler alloc] initWithName:@"RACWorkStealingSchedulerTests" workerCount:4];
+    });
+
+    return scheduler;
+}
+
+- (void)testWorkerCount {
+    XCTAssertEqual(self.class.scheduler.workerCount, 4U);
+
+    RACWorkStealingScheduler *sibling = [self.class.scheduler schedulerWithName:nil];
+    XCTAssertEqual(sibling.workerCount, 4U);
+}
+
+- (void)testBlocksExecuteSeriallyAndInOrder {
+    RACWorkStealingScheduler *scheduler = [self.class.scheduler schedulerWithName:@"serial"];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"all blocks executed"];
+
+    const NSUInteger count = 1000;
+    NSMutableArray *order = [NSMutableArray arrayWithCapacity:count];
+    __block volatile int32_t executing = 0;
+
+    for (NSUInteger i = 0; i < count; i++) {
+        [scheduler schedule:^{
+            XCTAssertEqual(OSAtomicIncrement32(&executing), 1);
+            XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+
+            [order addObject:@(i)];
+            if (i == count - 1) [expectation fulfill];
+
+            OSAtomicDecrement32(&executing);
+        }];
+    }
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+
+    for (NSUInteger i = 0; i < count; i++) {
+        XCTAssertEqualObjects(order[i], @(i));
+    }
+}
+
+- (void)testSchedulersOnOnePoolExecuteInParallel {
+    RACWorkStealingScheduler *first = [self.class.scheduler schedulerWithName:@"first"];
+    RACWorkStealingScheduler *second = [self.class.scheduler schedulerWithName:@"second"];
+
+    // Each block waits for the other, so this only finishes if both run at the
+    // same time.
+    dispatch_semaphore_t firstStarted = dispatch_semaphore_create(0);
+    dispatch_semaphore_t secondStarted = dispatch_semaphore_create(0);
+    XCTestExpectation *firstFinished = [self expectationWithDescription:@"first finished"];
+    XCTestExpectation *secondFinished = [self expectationWithDescription:@"second finished"];
+
+    [first schedule:^{
+        dispatch_semaphore_signal(firstStarted);
+        XCTAssertEqual(dispatch_semaphore_wait(secondStarted, dispatch_time(DISPATCH_TIME_NOW, 5 * NSEC_PER_SEC)), 0L);
+        [firstFinished fulfill];
+    }];
+
+    [second schedule:^{
+        dispatch_semaphore_signal(secondStarted);
+        XCTAssertEqual(dispatch_semaphore_wait(firstStarted, dispatch_time(DISPATCH_TIME_NOW, 5 * NSEC_PER_SEC)), 0L);
+        [secondFinished fulfill];
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+- (void)testDisposedBlocksDoNotExecute {
+    RACWorkStealingScheduler *scheduler = [self.class.scheduler schedulerWithName:nil];
+    XCTestExpectation *expectation = [self expectationWithDescription:@"last block executed"];
+
+    __block BOOL executed = NO;
+    dispatch_semaphore_t gate = dispatch_semaphore_create(0);
+
+    [scheduler schedule:^{
+        dispatch_semaphore_wait(gate, DISPATCH_TIME_FOREVER);
+    }];
+
+    RACDisposable *disposable = [scheduler schedule:^{
+        executed = YES;
+    }];
+
+    [scheduler schedule:^{
+        [expectation fulfill];
+    }];
+
+    [disposable dispose];
+    dispatch_semaphore_signal(gate);
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+    XCTAssertFalse(executed);
+}
+
+- (void)testTimers {
+    RACWorkStealingScheduler *scheduler = [self.class.scheduler schedulerWithName:nil];
+    XCTestExpectation *delayed = [self expectationWithDescription:@"delayed block executed"];
+    XCTestExpectation *repeated = [self expectationWithDescription:@"repeating block executed three times"];
+
+    NSDate *start = [NSDate date];
+    [scheduler after:[start dateByAddingTimeInterval:0.05] schedule:^{
+        XCTAssertGreaterThanOrEqual(-start.timeIntervalSinceNow, 0.05);
+        XCTAssertEqual(RACScheduler.currentScheduler, scheduler);
+        [delayed fulfill];
+    }];
+
+    __block NSUInteger count = 0;
+    __block RACDisposable *disposable = nil;
+    disposable = [scheduler after:start repeatingEvery:0.01 withLeeway:0 schedule:^{
+        if (++count == 3) {
+            [disposable dispose];
+            [repeated fulfill];
+        }
+    }];
+
+    [self waitForExpectationsWithTimeout:10 handler:nil];
+}
+
+@end
@@ -6,7 +6,7 @@
 //  Copyright © 2020 WoQi. All rights reserved.
 //
 
-#import <XCTest/XCTest"
+#import <XCTest/XCTest.h>
 
 @interface ReactiveObjCStudyTests : XCTestCase
 